@@ -0,0 +1,675 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Benchmarks for MST engines over synthetic graph families.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+/// Usage: bench [--min-exp K] [--max-exp K] [--reps N] [--threads N]
+///              [--max-edges M] [--family NAME] [--engine NAME]
+///              [--calibrate FILE]
+///
+/// For every graph family and every size 10^min-exp..10^max-exp vertices
+/// (10^3..10^7 by default) runs every MST engine and reports the best time of
+/// N repetitions, the throughput in edges per second, the number of heap
+/// allocations per edge and the peak resident set size of the process so far.
+/// Sizes are cut so that graphs have at most M edges (4M by default), since
+/// an EdgeLblUGraph takes a few hundred bytes per edge; cut and skipped sizes
+/// are reported, so 10^7 needs a greater M and a machine with enough memory.
+///
+/// With --calibrate, measures where engines overtake each other instead and
+/// writes thresholds for findMST() to FILE (see MSTCalibration).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include "ugraph/ugraph_algos.hpp"
+#include "ugraph/mst_dispatch.hpp"
+
+
+//==============================================================================
+// Allocation counting
+//==============================================================================
+
+static std::atomic<std::size_t> allocsNum(0);
+
+// the allocation and deallocation functions that call std::malloc() and
+// std::free() are never inlined: otherwise the compiler sees memory given by
+// one of them freed by the other and warns about a mismatch
+// (-Wmismatched-new-delete); the other forms go through these two
+#if defined(__GNUC__)
+#define BENCH_NOINLINE __attribute__((noinline))
+#else
+#define BENCH_NOINLINE
+#endif
+
+BENCH_NOINLINE void* operator new(std::size_t size)
+{
+    allocsNum.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+BENCH_NOINLINE void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { operator delete(p); }
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+void operator delete[](void* p, std::size_t) noexcept { operator delete(p); }
+
+
+/// Returns the peak resident set size of the process in megabytes.
+static double getPeakRssMb()
+{
+#if defined(__unix__)
+    rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss / 1024.0;               // kilobytes on Linux
+#elif defined(__APPLE__)
+    rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss / (1024.0 * 1024.0);    // bytes on macOS
+#else
+    return 0;
+#endif
+}
+
+
+//==============================================================================
+// Graph families
+//==============================================================================
+
+typedef EdgeLblUGraph<int, int> Graph;
+typedef Graph::Snapshot Snapshot;
+typedef std::set<Graph::Edge> EdgesSet;
+
+/// Labeled edge of a generated graph.
+struct GenEdge {
+    int s;
+    int d;
+    int lbl;
+};
+
+/// Generates edges of a graph with about \a n vertices.
+typedef std::function<std::vector<GenEdge>(int n, std::mt19937_64& rnd)> Generator;
+
+/// Random label of an edge.
+static int makeLabel(std::mt19937_64& rnd)
+{
+    return static_cast<int>(rnd() % 1000000);
+}
+
+/// Erdős–Rényi G(n, m) graph with the average degree 8.
+static std::vector<GenEdge> makeErdosRenyi(int n, std::mt19937_64& rnd)
+{
+    std::vector<GenEdge> edges;
+    std::size_t m = static_cast<std::size_t>(n) * 4;
+    edges.reserve(m);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        GenEdge e = {static_cast<int>(rnd() % n), static_cast<int>(rnd() % n), makeLabel(rnd)};
+        edges.push_back(e);
+    }
+
+    return edges;
+}
+
+/// Square grid graph with about n vertices.
+static std::vector<GenEdge> makeGrid(int n, std::mt19937_64& rnd)
+{
+    int side = static_cast<int>(std::sqrt(static_cast<double>(n)));
+    std::vector<GenEdge> edges;
+    edges.reserve(static_cast<std::size_t>(side) * side * 2);
+    for (int r = 0; r < side; ++r)
+    {
+        for (int c = 0; c < side; ++c)
+        {
+            int v = r * side + c;
+            if (c + 1 < side)
+            {
+                GenEdge e = {v, v + 1, makeLabel(rnd)};
+                edges.push_back(e);
+            }
+            if (r + 1 < side)
+            {
+                GenEdge e = {v, v + side, makeLabel(rnd)};
+                edges.push_back(e);
+            }
+        }
+    }
+
+    return edges;
+}
+
+/// Power-law R-MAT graph (a = 0.57, b = c = 0.19) with the average degree 8.
+static std::vector<GenEdge> makeRmat(int n, std::mt19937_64& rnd)
+{
+    int scale = 0;
+    while ((1 << scale) < n)
+        ++scale;
+
+    std::uniform_real_distribution<double> uni(0.0, 1.0);
+    std::vector<GenEdge> edges;
+    std::size_t m = static_cast<std::size_t>(n) * 4;
+    edges.reserve(m);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        int s = 0, d = 0;
+        for (int bit = 0; bit < scale; ++bit)
+        {
+            double p = uni(rnd);
+            if (p < 0.57)
+                continue;
+            if (p < 0.76)
+                d |= 1 << bit;
+            else if (p < 0.95)
+                s |= 1 << bit;
+            else
+            {
+                s |= 1 << bit;
+                d |= 1 << bit;
+            }
+        }
+        GenEdge e = {s % n, d % n, makeLabel(rnd)};
+        edges.push_back(e);
+    }
+
+    return edges;
+}
+
+/// Complete graph on n vertices.
+static std::vector<GenEdge> makeComplete(int n, std::mt19937_64& rnd)
+{
+    std::vector<GenEdge> edges;
+    edges.reserve(static_cast<std::size_t>(n) * (n - 1) / 2);
+    for (int s = 0; s < n; ++s)
+    {
+        for (int d = s + 1; d < n; ++d)
+        {
+            GenEdge e = {s, d, makeLabel(rnd)};
+            edges.push_back(e);
+        }
+    }
+
+    return edges;
+}
+
+/// Family of graphs.
+struct Family {
+    std::string name;
+    Generator gen;
+    /// Max number of vertices that keeps the number of edges under the limit.
+    std::function<std::size_t(std::size_t maxEdges)> maxVertices;
+};
+
+
+//==============================================================================
+// Engines
+//==============================================================================
+
+/// Prepared inputs of engines.
+struct Input {
+    const Graph* graph;
+    const Snapshot* snapshot;
+    WorkStealingPool* pool;
+};
+
+/// MST engine under test.
+struct Engine {
+    std::string name;
+    std::function<EdgesSet(const Input&)> run;
+    bool dense;         ///< Needs O(V^2) memory, so is run for small V only.
+};
+
+/// Options of findMST() for the given input.
+static MSTOptions makeOptions(const Input& in)
+{
+    MSTOptions opts;
+    opts.pool = in.pool;
+    return opts;
+}
+
+static std::vector<Engine> makeEngines()
+{
+    std::vector<Engine> engines;
+    engines.push_back({"prim",
+        [](const Input& in) { return findMSTPrimHeap(*in.graph); }, false});
+    engines.push_back({"prim_csr",
+        [](const Input& in) { return findMSTPrimHeap(*in.snapshot); }, false});
+    engines.push_back({"prim_dense",
+        [](const Input& in) { return findMSTPrimDense(*in.graph); }, true});
+    engines.push_back({"prim_dense_csr",
+        [](const Input& in) { return findMSTPrimDense(*in.snapshot); }, true});
+    engines.push_back({"kruskal",
+        [](const Input& in) { return findMSTKruskal(*in.graph); }, false});
+    engines.push_back({"kruskal_csr",
+        [](const Input& in) { return findMSTKruskal(*in.snapshot); }, false});
+    engines.push_back({"boruvka_csr",
+        [](const Input& in) { return findMSTParallel(*in.snapshot, *in.pool); }, false});
+    engines.push_back({"auto",
+        [](const Input& in) { return findMST(*in.graph, makeOptions(in)); }, false});
+    engines.push_back({"auto_csr",
+        [](const Input& in) { return findMST(*in.snapshot, makeOptions(in)); }, false});
+
+    return engines;
+}
+
+
+//==============================================================================
+// Calibration
+//==============================================================================
+
+/// Returns the best time of \a reps runs of \a f in milliseconds.
+template <typename F>
+static double measureMs(int reps, F f)
+{
+    double best = 0;
+    for (int r = 0; r < reps; ++r)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto finish = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(finish - start).count();
+        if (r == 0 || ms < best)
+            best = ms;
+    }
+
+    return best;
+}
+
+/// Makes a G(n, p) graph: every pair of vertices is an edge with the
+/// probability \a p.
+template <typename Lbl>
+static EdgeLblUGraph<int, Lbl> makeDensityGraph(int n, double p, std::mt19937_64& rnd)
+{
+    typedef EdgeLblUGraph<int, Lbl> LblGraph;
+
+    std::uniform_real_distribution<double> uni(0.0, 1.0);
+    std::vector<typename LblGraph::LblEdgeTuple> batch;
+    for (int s = 0; s < n; ++s)
+    {
+        for (int d = s + 1; d < n; ++d)
+        {
+            if (uni(rnd) < p)
+                batch.push_back(typename LblGraph::LblEdgeTuple(s, d, static_cast<Lbl>(makeLabel(rnd))));
+        }
+    }
+
+    LblGraph g;
+    g.addLblEdges(batch.begin(), batch.end());
+    return g;
+}
+
+/// Makes a graph from the edges of the family \a gen.
+static Graph makeFamilyGraph(const Generator& gen, int n, std::mt19937_64& rnd)
+{
+    std::vector<Graph::LblEdgeTuple> batch;
+    for (const GenEdge& e : gen(n, rnd))
+        batch.push_back(Graph::LblEdgeTuple(e.s, e.d, e.lbl));
+
+    Graph g;
+    g.addLblEdges(batch.begin(), batch.end());
+    return g;
+}
+
+/// Measured point: a parameter of a graph and whether the challenger engine
+/// has won on it.
+typedef std::pair<double, bool> CalibrationPoint;
+
+/// Returns the least parameter starting from which the challenger wins at
+/// every point, or \a never if it loses at the last one.
+static double findWinsFrom(const std::vector<CalibrationPoint>& points, double never)
+{
+    double res = never;
+    for (auto it = points.rbegin(); it != points.rend() && it->second; ++it)
+        res = it->first;
+
+    return res;
+}
+
+/// Returns the greatest parameter up to which the challenger wins at every
+/// point, or \a never if it loses at the first one.
+static double findWinsUpTo(const std::vector<CalibrationPoint>& points, double never)
+{
+    double res = never;
+    for (auto it = points.begin(); it != points.end() && it->second; ++it)
+        res = it->first;
+
+    return res;
+}
+
+/// Compares dense Prim with heap Prim on G(n, p) graphs with labels of the
+/// type Lbl; fills points for graphs and (optionally) for snapshots.
+template <typename Lbl>
+static void calibrateDensity(int reps, std::vector<CalibrationPoint>* graphPoints,
+                             std::vector<CalibrationPoint>& snapshotPoints)
+{
+    const int n = 1500;
+    for (double p : {0.01, 0.02, 0.05, 0.1, 0.2, 0.35, 0.5, 0.75, 1.0})
+    {
+        std::mt19937_64 rnd(n);
+        EdgeLblUGraph<int, Lbl> g = makeDensityGraph<Lbl>(n, p, rnd);
+        typename EdgeLblUGraph<int, Lbl>::Snapshot sn = g.freeze();
+        const double density = g.getEdgesNum() / (0.5 * n * (n - 1.0));
+
+        std::cout << "  density " << std::setw(5) << std::setprecision(2) << density
+                  << " (" << sizeof(Lbl) * 8 << "-bit labels):";
+        if (graphPoints)
+        {
+            double heap = measureMs(reps, [&]() { findMSTPrimHeap(g); });
+            double dense = measureMs(reps, [&]() { findMSTPrimDense(g); });
+            graphPoints->push_back(CalibrationPoint(density, dense < heap));
+            std::cout << " graph heap/dense " << heap << "/" << dense << " ms;";
+        }
+
+        double heap = measureMs(reps, [&]() { findMSTPrimHeap(sn); });
+        double dense = measureMs(reps, [&]() { findMSTPrimDense(sn); });
+        snapshotPoints.push_back(CalibrationPoint(density, dense < heap));
+        std::cout << " snapshot heap/dense " << heap << "/" << dense << " ms\n";
+    }
+}
+
+/// Measures the engines on graphs of various shapes and makes thresholds
+/// for findMST() out of the results.
+static MSTCalibration calibrate(int reps, WorkStealingPool& pool)
+{
+    MSTCalibration c;
+    const double never = 2.0;           // densities never exceed 1
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::cout << "Dense Prim vs heap Prim:\n";
+    std::vector<CalibrationPoint> graphPoints, snapshotPoints, widePoints;
+    calibrateDensity<int>(reps, &graphPoints, snapshotPoints);
+    c.denseDensityGraph = findWinsFrom(graphPoints, never);
+    c.denseDensitySnapshot = findWinsFrom(snapshotPoints, never);
+    if (IsVectorizedArgMin<int, WeightTraits<int>::Compare>::value)
+    {
+        calibrateDensity<long long>(reps, nullptr, widePoints);
+        if (c.denseDensitySnapshot < never)
+            c.denseScalarFactor = findWinsFrom(widePoints, never) / c.denseDensitySnapshot;
+    }
+
+    std::cout << "Kruskal vs heap Prim:\n";
+    graphPoints.clear();
+    snapshotPoints.clear();
+    const int n = 20000;
+    for (int degree : {2, 4, 8, 16, 32, 64})
+    {
+        std::mt19937_64 rnd(n);
+        const std::size_t m = static_cast<std::size_t>(n) * degree / 2;
+        Graph g = makeFamilyGraph([m](int vn, std::mt19937_64& r)
+            {
+                std::vector<GenEdge> edges;
+                for (std::size_t i = 0; i < m; ++i)
+                    edges.push_back({static_cast<int>(r() % vn), static_cast<int>(r() % vn),
+                                     makeLabel(r)});
+                return edges;
+            }, n, rnd);
+        Snapshot sn = g.freeze();
+        const double realDegree = 2.0 * g.getEdgesNum() / n;
+
+        double primG = measureMs(reps, [&]() { findMSTPrimHeap(g); });
+        double kruskalG = measureMs(reps, [&]() { findMSTKruskal(g); });
+        double primS = measureMs(reps, [&]() { findMSTPrimHeap(sn); });
+        double kruskalS = measureMs(reps, [&]() { findMSTKruskal(sn); });
+        graphPoints.push_back(CalibrationPoint(realDegree, kruskalG < primG));
+        snapshotPoints.push_back(CalibrationPoint(realDegree, kruskalS < primS));
+        std::cout << "  degree " << std::setw(6) << realDegree
+                  << ": graph prim/kruskal " << primG << "/" << kruskalG
+                  << " ms; snapshot prim/kruskal " << primS << "/" << kruskalS << " ms\n";
+    }
+    c.kruskalMaxDegreeGraph = findWinsUpTo(graphPoints, 0);
+    c.kruskalMaxDegreeSnapshot = findWinsUpTo(snapshotPoints, 0);
+
+    // Borůvka is compared with the best sequential engine on snapshots
+    c.parallelMinEdges = static_cast<std::size_t>(-1);
+    if (pool.getThreadsNum() > 1)
+    {
+        std::cout << "Borůvka on " << pool.getThreadsNum() << " threads vs sequential:\n";
+        std::vector<CalibrationPoint> points;
+        for (int vn = 1 << 12; vn <= 1 << 18; vn <<= 1)
+        {
+            std::mt19937_64 rnd(vn);
+            Snapshot sn = makeFamilyGraph(makeErdosRenyi, vn, rnd).freeze();
+
+            double seq = std::min(measureMs(reps, [&]() { findMSTPrimHeap(sn); }),
+                                  measureMs(reps, [&]() { findMSTKruskal(sn); }));
+            double par = measureMs(reps, [&]() { findMSTParallel(sn, pool); });
+            points.push_back(CalibrationPoint(static_cast<double>(sn.getEdgesNum()), par < seq));
+            std::cout << "  edges " << std::setw(8) << sn.getEdgesNum()
+                      << ": sequential/parallel " << seq << "/" << par << " ms\n";
+        }
+
+        double from = findWinsFrom(points, -1);
+        if (from >= 0)
+            c.parallelMinEdges = static_cast<std::size_t>(from);
+    }
+    else
+        std::cout << "Borůvka is not calibrated: a single thread is available\n";
+
+    return c;
+}
+
+
+//==============================================================================
+// Runner
+//==============================================================================
+
+/// Options of a run.
+struct Options {
+    int minExp = 3;
+    int maxExp = 7;
+    int reps = 3;
+    std::size_t threads = 0;
+    std::size_t maxEdges = 4000000;
+    std::string family;
+    std::string engine;
+    std::string calibrationFile;
+};
+
+static void printUsage()
+{
+    std::cerr << "Usage: bench [--min-exp K] [--max-exp K] [--reps N] [--threads N]\n"
+                 "             [--max-edges M] [--family NAME] [--engine NAME]\n"
+                 "             [--calibrate FILE]\n"
+                 "Families: er, grid, rmat, complete.\n";
+}
+
+static bool parseOptions(int argc, char* argv[], Options& opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+            return false;
+
+        std::string val = argv[++i];
+        if (arg == "--min-exp")
+            opts.minExp = std::atoi(val.c_str());
+        else if (arg == "--max-exp")
+            opts.maxExp = std::atoi(val.c_str());
+        else if (arg == "--reps")
+            opts.reps = std::max(1, std::atoi(val.c_str()));
+        else if (arg == "--threads")
+            opts.threads = std::strtoul(val.c_str(), nullptr, 10);
+        else if (arg == "--max-edges")
+            opts.maxEdges = std::strtoul(val.c_str(), nullptr, 10);
+        else if (arg == "--family")
+            opts.family = val;
+        else if (arg == "--engine")
+            opts.engine = val;
+        else if (arg == "--calibrate")
+            opts.calibrationFile = val;
+        else
+            return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    Options opts;
+    if (!parseOptions(argc, argv, opts))
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<Family> families;
+    families.push_back({"er", makeErdosRenyi,
+        [](std::size_t maxEdges) { return maxEdges / 4; }});
+    families.push_back({"grid", makeGrid,
+        [](std::size_t maxEdges) { return maxEdges / 2; }});
+    families.push_back({"rmat", makeRmat,
+        [](std::size_t maxEdges) { return maxEdges / 4; }});
+    families.push_back({"complete", makeComplete,
+        [](std::size_t maxEdges) { return static_cast<std::size_t>(std::sqrt(2.0 * maxEdges)); }});
+
+    std::vector<Engine> engines = makeEngines();
+    WorkStealingPool pool(opts.threads);
+
+    if (!opts.calibrationFile.empty())
+    {
+        MSTCalibration c = calibrate(opts.reps, pool);
+        std::ofstream f(opts.calibrationFile.c_str());
+        writeMSTCalibration(f, c);
+        if (!f)
+        {
+            std::cerr << "Can't write " << opts.calibrationFile << "\n";
+            return 1;
+        }
+
+        std::cout << "Calibration:\n" << std::defaultfloat;
+        writeMSTCalibration(std::cout, c);
+        return 0;
+    }
+
+    std::cout << "Threads: " << pool.getThreadsNum() << ", repetitions: " << opts.reps << "\n";
+    std::cout << std::left << std::setw(36) << "Benchmark"
+              << std::right << std::setw(12) << "Edges"
+              << std::setw(14) << "Time, ms"
+              << std::setw(16) << "Edges/s"
+              << std::setw(14) << "Allocs/edge"
+              << std::setw(14) << "PeakRSS, MB"
+              << std::setw(12) << "MST weight" << "\n";
+    std::cout << std::string(118, '-') << "\n";
+
+    for (const Family& fam : families)
+    {
+        if (!opts.family.empty() && opts.family != fam.name)
+            continue;
+
+        std::size_t lastN = 0;
+        for (int exp = opts.minExp; exp <= opts.maxExp; ++exp)
+        {
+            std::size_t n = 1;
+            for (int i = 0; i < exp; ++i)
+                n *= 10;
+            const std::size_t maxN = fam.maxVertices(opts.maxEdges);
+            if (n > maxN)
+            {
+                if (maxN < 2 || maxN == lastN)
+                {
+                    std::cout << "skipped " << fam.name << " 10^" << exp
+                              << ": over --max-edges " << opts.maxEdges << "\n";
+                    continue;                       // nothing new under the limit
+                }
+                std::cout << "cut " << fam.name << " 10^" << exp << " to " << maxN
+                          << " vertices: over --max-edges " << opts.maxEdges << "\n";
+                n = maxN;
+            }
+            lastN = n;
+
+            std::mt19937_64 rnd(n);
+            std::vector<GenEdge> genEdges = fam.gen(static_cast<int>(n), rnd);
+
+            std::vector<Graph::LblEdgeTuple> batch;
+            batch.reserve(genEdges.size());
+            for (const GenEdge& e : genEdges)
+                batch.push_back(Graph::LblEdgeTuple(e.s, e.d, e.lbl));
+            genEdges = std::vector<GenEdge>();
+
+            Graph g;
+            g.addLblEdges(batch.begin(), batch.end());
+            batch = std::vector<Graph::LblEdgeTuple>();
+
+            Snapshot sn = g.freeze();
+            Input in = {&g, &sn, &pool};
+            const std::size_t m = g.getEdgesNum();
+
+            for (const Engine& eng : engines)
+            {
+                if (!opts.engine.empty() && opts.engine != eng.name)
+                    continue;
+                if (eng.dense && sn.getVerticesNum() * sn.getVerticesNum() > 4 * opts.maxEdges)
+                    continue;                       // the matrix doesn't fit the limit
+
+                double bestMs = 0;
+                std::size_t allocs = 0;
+                long long weight = 0;
+                for (int r = 0; r < opts.reps; ++r)
+                {
+                    std::size_t allocsBefore = allocsNum.load();
+                    auto start = std::chrono::steady_clock::now();
+                    EdgesSet mst = eng.run(in);
+                    auto finish = std::chrono::steady_clock::now();
+                    allocs = allocsNum.load() - allocsBefore;
+
+                    double ms = std::chrono::duration<double, std::milli>(finish - start).count();
+                    if (r == 0 || ms < bestMs)
+                        bestMs = ms;
+
+                    weight = 0;
+                    int lbl;
+                    for (const Graph::Edge& e : mst)
+                        weight += sn.getLabel(e.first, e.second, lbl) ? lbl : 0;
+                }
+
+                std::ostringstream name;
+                name << eng.name << "/" << fam.name << "/" << n;
+                std::cout << std::left << std::setw(36) << name.str()
+                          << std::right << std::setw(12) << m
+                          << std::setw(14) << std::fixed << std::setprecision(2) << bestMs
+                          << std::setw(16) << std::setprecision(0)
+                          << (bestMs > 0 ? m / (bestMs / 1000.0) : 0.0)
+                          << std::setw(14) << std::setprecision(2)
+                          << (m ? static_cast<double>(allocs) / m : 0.0)
+                          << std::setw(14) << std::setprecision(1) << getPeakRssMb()
+                          << std::setw(12) << weight << "\n";
+            }
+        }
+    }
+
+    return 0;
+}
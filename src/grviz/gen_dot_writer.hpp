@@ -19,9 +19,193 @@
 #include <list>
 #include <string>
 #include <fstream>
+#include <sstream>
+#include <vector>
+#include <cstring>
+#include <type_traits>
 
 namespace xi { namespace ldopa { namespace graph {
 
+/*! ****************************************************************************
+ *  \brief Output buffer for writing large DOT-files.
+ *
+ *  Collects the output in one reusable buffer and writes it to the underlying
+ *  stream in big blocks. Values are formatted with the flags of the stream
+ *  they are taken from when the buffer is created, so the output is the same
+ *  as if they were written to the stream directly. Integers are converted to
+ *  decimal strings right in the buffer unless the stream outputs them in
+ *  another way (other base, a plus sign, etc); values of other types are
+ *  formatted by the stream operator.
+ ******************************************************************************/
+class DotOutBuffer
+{
+public:
+    //----<Constructors>----
+    explicit DotOutBuffer(std::ostream& str, std::size_t capacity = 1 << 16)
+        : _str(str)
+        , _buf(capacity < 64 ? 64 : capacity)
+        , _len(0)
+    {
+        _ss.copyfmt(str);
+        const std::ios_base::fmtflags base = str.flags() & std::ios_base::basefield;
+        _decimalInts = (base == std::ios_base::dec || base == 0)
+            && !(str.flags() & std::ios_base::showpos) && str.width() == 0;
+    }
+
+    /** \brief Flushes the rest of the buffer. */
+    ~DotOutBuffer()
+    {
+        flush();
+    }
+
+    DotOutBuffer(const DotOutBuffer&) = delete;
+    DotOutBuffer& operator=(const DotOutBuffer&) = delete;
+
+    //----<Traits>----
+
+    /** \brief Determines whether a value of the type T is output as a decimal
+     *  number (characters are not). */
+    template <typename T>
+    struct IsDecimal : std::integral_constant<bool,
+        std::is_integral<T>::value && !std::is_same<T, bool>::value
+        && !std::is_same<T, char>::value && !std::is_same<T, signed char>::value
+        && !std::is_same<T, unsigned char>::value && !std::is_same<T, wchar_t>::value
+        && !std::is_same<T, char16_t>::value && !std::is_same<T, char32_t>::value>
+    {
+    };
+
+    //----<Output methods>----
+    void put(char c)
+    {
+        if (_len == _buf.size())
+            flush();
+        _buf[_len++] = c;
+    }
+
+    void put(const char* s, std::size_t n)
+    {
+        if (_len + n > _buf.size())
+        {
+            flush();
+            if (n > _buf.size())
+            {
+                _str.write(s, n);
+                return;
+            }
+        }
+        std::memcpy(&_buf[_len], s, n);
+        _len += n;
+    }
+
+    /** \brief Outputs the value \a v as the stream operator does. */
+    template <typename T>
+    void putValue(const T& v)
+    {
+        putValue(v, IsDecimal<T>());
+    }
+
+    /** \brief Outputs the value \a v as the stream operator does, escaping
+     *  special symbols and enclosing the result into dblquotes (see
+     *  DefaultDotVisitor::makeEscapedString()). */
+    template <typename T>
+    void putEscapedValue(const T& v)
+    {
+        put('\"');
+        if (IsDecimal<T>::value && _decimalInts)
+            putValue(v);                // numbers need no escaping
+        else
+        {
+            _ss.str(std::string());
+            _ss << v;
+            const std::string& s = _ss.str();
+            for (char c : s)
+            {
+                if (c == '"' || c == '\\')
+                    put('\\');
+                put(c);
+            }
+        }
+        put('\"');
+    }
+
+    /** \brief Writes the content of the buffer to the stream. */
+    void flush()
+    {
+        if (_len)
+            _str.write(_buf.data(), _len);
+        _len = 0;
+    }
+
+    //----<Operators>----
+    DotOutBuffer& operator<<(const char* s)
+    {
+        put(s, std::strlen(s));
+        return *this;
+    }
+
+    DotOutBuffer& operator<<(const std::string& s)
+    {
+        put(s.data(), s.size());
+        return *this;
+    }
+
+    template <typename T>
+    DotOutBuffer& operator<<(const T& v)
+    {
+        putValue(v);
+        return *this;
+    }
+
+protected:
+    /** \brief Converts an integer into decimal digits in the buffer. */
+    template <typename T>
+    void putValue(const T& v, std::true_type)
+    {
+        if (!_decimalInts)
+        {
+            putValue(v, std::false_type());
+            return;
+        }
+
+        char digits[24];
+        char* end = digits + sizeof(digits);
+        char* p = end;
+
+        typedef typename std::make_unsigned<T>::type UT;
+        bool neg = v < 0;
+        UT u = neg ? static_cast<UT>(0) - static_cast<UT>(v) : static_cast<UT>(v);
+        do
+        {
+            *--p = static_cast<char>('0' + u % 10);
+            u /= 10;
+        } while (u);
+        if (neg)
+            *--p = '-';
+
+        put(p, static_cast<std::size_t>(end - p));
+    }
+
+    /** \brief Formats a value of an arbitrary type by the stream operator. */
+    template <typename T>
+    void putValue(const T& v, std::false_type)
+    {
+        _ss.str(std::string());
+        _ss << v;
+        const std::string& s = _ss.str();
+        put(s.data(), s.size());
+    }
+
+protected:
+    std::ostream& _str;             ///< Underlying stream.
+    std::vector<char> _buf;         ///< Buffer.
+    std::size_t _len;               ///< Number of used bytes of the buffer.
+    std::ostringstream _ss;         ///< Reusable stream for formatting values.
+    bool _decimalInts;              ///< Integers are output as plain decimals.
+}; // class DotOutBuffer
+
+//=============================================================================
+
+
 /*! ****************************************************************************
  *  \brief Default visitor class.
  *
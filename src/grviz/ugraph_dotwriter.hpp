@@ -22,7 +22,10 @@
 #include "../ugraph/lbl_ugraph.hpp"
 
 
-/** \brief DOT-writer for EvLogTSWithFreqs models. */
+/** \brief DOT-writer for EvLogTSWithFreqs models.
+ *
+ *  By default writes through a DotOutBuffer; the unbuffered mode formats every
+ *  edge separately and gives the same output. */
 template <typename Vertex, typename EdgeLbl>
 struct EdgeLblUGraphDotVisitor :
     public xi::ldopa::graph::DefaultDotVisitor < EdgeLblUGraph<Vertex, EdgeLbl> >
@@ -32,35 +35,148 @@ struct EdgeLblUGraphDotVisitor :
         < EdgeLblUGraph<Vertex, EdgeLbl> > Base;
 
 
-    EdgeLblUGraphDotVisitor() : Base(Base::Sort::graph) {}
+    EdgeLblUGraphDotVisitor(bool tBuffered = true)
+        : Base(Base::Sort::graph)
+        , buffered(tBuffered)
+    {
+    }
 
     void outputBody(std::ostream& str, const Graph& g)
+    {
+        if(buffered)
+        {
+            xi::ldopa::graph::DotOutBuffer out(str);
+            outputBodyTo(out, g);
+        }
+        else
+            outputBodyTo(str, g);
+    }
+
+    /// Outputs vertices and edges to \a out that is an std::ostream or
+    /// a DotOutBuffer.
+    template <typename TOut>
+    void outputBodyTo(TOut& out, const Graph& g)
     {
         // enumerates all vertices
         typename Graph::VertexIterPair vs = g.getVertices();
         for(typename Graph::VertexIter it = vs.first; it != vs.second; ++it)
         {
-            str << *it << "\n";     // see code below for example how to add params
+            out << *it << "\n";     // see code below for example how to add params
         }
 
         // enumerates all edges
         typename Graph::EdgeIterPair es = g.getEdges();
         for(typename Graph::EdgeIter it = es.first; it != es.second; ++it)
         {
-            typename Base::ParamValueList pars;    // edge attributes
             EdgeLbl lbl;
-            if(g.getLabel(it->first, it->second, lbl))
+            bool hasLbl = g.getLabel(it->first, it->second, lbl);
+            outputEdge(out, it->first, it->second, hasLbl ? &lbl : nullptr);
+        }
+    }
+
+    /// Outputs an edge {s, d} labeled with \a lbl if it is not null.
+    static void outputEdge(std::ostream& str, const Vertex& s, const Vertex& d,
+                           const EdgeLbl* lbl)
+    {
+        typename Base::ParamValueList pars;    // edge attributes
+        if(lbl)
+        {
+            // use string stream to convert an arbitrary type EdgeLbl to a string
+            std::stringstream ss;
+            ss << *lbl;
+            pars.append("label", Base::makeEscapedString(ss.str()));
+        }
+
+        str << s << " -- " << d
+            << " " << Base::makeParamValueStr(pars)  << "\n";
+    }
+
+    /// Outputs an edge {s, d} labeled with \a lbl if it is not null to the
+    /// buffer \a out; the output is the same as of the previous method.
+    static void outputEdge(xi::ldopa::graph::DotOutBuffer& out, const Vertex& s,
+                           const Vertex& d, const EdgeLbl* lbl)
+    {
+        out << s << " -- " << d << " ";
+        if(lbl)
+        {
+            out.put("[label=", 7);
+            out.putEscapedValue(*lbl);
+            out.put(']');
+        }
+        out.put('\n');
+    }
+
+    /// Whether the output is buffered.
+    bool buffered;
+};
+
+
+
+/** \brief DOT-writer for snapshots of labeled graphs; gives the same output as
+ *  EdgeLblUGraphDotVisitor does for the graph a snapshot is made of, except
+ *  for the order of edges adjacent to a vertex. */
+template <typename Vertex, typename EdgeLbl>
+struct CsrSnapshotDotVisitor :
+    public xi::ldopa::graph::DefaultDotVisitor < CsrSnapshot<Vertex, EdgeLbl> >
+{
+    typedef CsrSnapshot<Vertex, EdgeLbl> Graph;
+    typedef xi::ldopa::graph::DefaultDotVisitor
+        < CsrSnapshot<Vertex, EdgeLbl> > Base;
+    typedef typename Graph::VertexId VertexId;
+
+
+    CsrSnapshotDotVisitor(bool tBuffered = true)
+        : Base(Base::Sort::graph)
+        , buffered(tBuffered)
+    {
+    }
+
+    void outputBody(std::ostream& str, const Graph& g)
+    {
+        if(buffered)
+        {
+            xi::ldopa::graph::DotOutBuffer out(str);
+            outputBodyTo(out, g);
+        }
+        else
+            outputBodyTo(str, g);
+    }
+
+    /// Outputs vertices and edges to \a out that is an std::ostream or
+    /// a DotOutBuffer.
+    template <typename TOut>
+    void outputBodyTo(TOut& out, const Graph& g)
+    {
+        const VertexId n = static_cast<VertexId>(g.getVerticesNum());
+        for(VertexId v = 0; v < n; ++v)
+            out << g.getVertex(v) << "\n";
+
+        // every edge {s, d} is output once from the entry of the smaller
+        // vertex; a self-loop has two entries and is output from the second one
+        for(VertexId v = 0; v < n; ++v)
+        {
+            bool selfLoopHalf = false;
+            typename Graph::AdjCIterPair range = g.getAdjEdges(v);
+            for(typename Graph::AdjCIter it = range.first; it != range.second; ++it)
             {
-                // use string stream to convert an arbitrary type EdgeLbl to a string
-                std::stringstream ss;
-                ss << lbl;
-                pars.append("label", Base::makeEscapedString(ss.str()));
-            }
+                if(it->vertex < v)
+                    continue;
+                if(it->vertex == v)
+                {
+                    selfLoopHalf = !selfLoopHalf;
+                    if(selfLoopHalf)
+                        continue;
+                }
 
-            str << it->first << " -- " << it->second
-                << " " << Base::makeParamValueStr(pars)  << "\n";
+                EdgeLblUGraphDotVisitor<Vertex, EdgeLbl>::outputEdge(out,
+                    g.getVertex(v), g.getVertex(it->vertex),
+                    it->hasLbl ? &it->lbl : nullptr);
+            }
         }
     }
+
+    /// Whether the output is buffered.
+    bool buffered;
 };
 
 
@@ -81,5 +197,14 @@ struct EdgeLblUGraphDotWriter
             Type;
 };
 
+/// Metafunction for typedefing DOT-writers for CsrSnapshot.
+template <typename Vertex, typename EdgeLbl>
+struct CsrSnapshotDotWriter
+{
+    typedef xi::ldopa::graph::GenDotWriter < CsrSnapshot<Vertex, EdgeLbl>,
+                                             CsrSnapshotDotVisitor<Vertex, EdgeLbl> >
+            Type;
+};
+
 
 #endif //
@@ -0,0 +1,376 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a minimum spanning forest preprocessed for bottleneck
+///             (minimax) path queries.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOTTLENECK_TREE_HPP
+#define BOTTLENECK_TREE_HPP
+
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <cstddef>
+
+#include "ugraph_algos.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief The BottleneckTree class answers queries for the bottleneck of the
+ *  path between two vertices of a minimum spanning forest, i.e. the heaviest
+ *  label on it.
+ *
+ *  The bottleneck of the path in a MST is the least possible max label of a
+ *  path between the vertices in the whole graph (the minimax path).
+ *
+ *  Trees of the forest are rooted by BFS and binary lifting tables are built:
+ *  the jump k of a vertex leads to its ancestor 2^k levels up and keeps the
+ *  max label on the way. A query lifts the deeper vertex to the depth of the
+ *  other one and then both of them to their LCA, so it takes O(log H) time
+ *  for the height H of the trees. Only as many levels as the height needs are
+ *  kept: O(V log H) memory.
+ *
+ *  Queries do not change the object, so they may run in parallel.
+ *
+ *  \tparam Vertex represents a type for vertices.
+ *  \tparam EdgeLbl represents a type for edge labels.
+ *  \tparam TWeightTraits describes labels as weights (see WeightTraits).
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+class BottleneckTree {
+public:
+    // type definitions
+    typedef std::pair<Vertex, Vertex> Query;
+    typedef std::pair<VertexId, VertexId> IdQuery;
+
+    /// Denotes no vertex.
+    static const VertexId NoVertex = static_cast<VertexId>(-1);
+
+public:
+    /// \brief Builds the tables for the \a vertices (in any order, duplicates
+    /// are ignored) and the \a edges of their minimum spanning forest, e.g.
+    /// MSTEdges::edges.
+    ///
+    /// \throws std::invalid_argument if an edge has an unknown vertex or the
+    /// edges make a cycle.
+    /// \throws std::length_error if there are too many vertices.
+    BottleneckTree(std::vector<Vertex> vertices,
+                   const std::vector<LblEdge<Vertex, EdgeLbl> >& edges)
+        : _vertices(std::move(vertices))
+        , _levels(0)
+    {
+        std::sort(_vertices.begin(), _vertices.end());
+        _vertices.erase(std::unique(_vertices.begin(), _vertices.end(),
+                                    [](const Vertex& a, const Vertex& b)
+                                    {
+                                        return !(a < b) && !(b < a);
+                                    }),
+                        _vertices.end());
+        const std::size_t n = _vertices.size();
+        if (n >= NoVertex)
+            throw std::length_error("Too many vertices for a bottleneck tree");
+
+        // adjacency of the forest in CSR form
+        DisjointSet trees(n);
+        std::vector<IdEdge<EdgeLbl> > ids;
+        ids.reserve(edges.size());
+        std::vector<std::size_t> offsets(n + 1, 0);
+        for (const LblEdge<Vertex, EdgeLbl>& e : edges)
+        {
+            const std::size_t s = findId(e.s), d = findId(e.d);
+            if (s == n || d == n)
+                throw std::invalid_argument("Edge of a bottleneck tree has an unknown vertex");
+            if (!trees.unite(s, d))
+                throw std::invalid_argument("Edges of a bottleneck tree must not make a cycle");
+
+            IdEdge<EdgeLbl> ie = {static_cast<VertexId>(s), static_cast<VertexId>(d), e.lbl};
+            ids.push_back(ie);
+            ++offsets[s + 1];
+            ++offsets[d + 1];
+        }
+        for (std::size_t v = 0; v < n; ++v)
+            offsets[v + 1] += offsets[v];
+
+        std::vector<VertexId> adj(offsets[n]);
+        std::vector<EdgeLbl> adjLbls(offsets[n]);
+        std::vector<std::size_t> pos(offsets);
+        for (const IdEdge<EdgeLbl>& e : ids)
+        {
+            adj[pos[e.s]] = e.d;
+            adjLbls[pos[e.s]++] = e.lbl;
+            adj[pos[e.d]] = e.s;
+            adjLbls[pos[e.d]++] = e.lbl;
+        }
+
+        // every tree is rooted at its least vertex; BFS gives depths and the
+        // edges to parents
+        std::vector<Jump> up(n);
+        std::vector<VertexId> queue;
+        queue.reserve(n);
+        _depths.assign(n, NoVertex);
+        _roots.resize(n);
+        VertexId height = 0;
+        for (std::size_t r = 0; r < n; ++r)
+        {
+            if (_depths[r] != NoVertex)
+                continue;
+
+            _depths[r] = 0;
+            _roots[r] = static_cast<VertexId>(r);
+            up[r].to = static_cast<VertexId>(r);
+            up[r].max = TWeightTraits::zero();
+            queue.push_back(static_cast<VertexId>(r));
+            for (std::size_t h = queue.size() - 1; h < queue.size(); ++h)
+            {
+                const VertexId u = queue[h];
+                for (std::size_t j = offsets[u]; j < offsets[u + 1]; ++j)
+                {
+                    const VertexId v = adj[j];
+                    if (_depths[v] != NoVertex)
+                        continue;
+
+                    _depths[v] = _depths[u] + 1;
+                    _roots[v] = static_cast<VertexId>(r);
+                    up[v].to = u;
+                    up[v].max = adjLbls[j];
+                    height = std::max(height, _depths[v]);
+                    queue.push_back(v);
+                }
+            }
+        }
+
+        // the jump k + 1 is made of two jumps k; the ones going above a root
+        // stop at it and are never taken by queries
+        while ((std::size_t(1) << _levels) <= height)
+            ++_levels;
+        _jumps.resize(_levels * n);
+        if (_levels)
+            std::copy(up.begin(), up.end(), _jumps.begin());
+        for (std::size_t k = 1; k < _levels; ++k)
+        {
+            const Jump* prev = _jumps.data() + (k - 1) * n;
+            Jump* cur = _jumps.data() + k * n;
+            for (std::size_t v = 0; v < n; ++v)
+            {
+                const Jump& mid = prev[prev[v].to];
+                cur[v].to = mid.to;
+                cur[v].max = getMax(prev[v].max, mid.max);
+            }
+        }
+    }
+
+public:
+    // setters/getters
+
+    /// Returns the number of vertices.
+    std::size_t getVerticesNum() const { return _vertices.size(); }
+
+    /// Returns the vertex with the id \a v < getVerticesNum(); ids are given
+    /// in ascending order of vertices.
+    const Vertex& getVertex(VertexId v) const { return _vertices[v]; }
+
+    /// \brief Returns the id of the vertex \a v.
+    ///
+    /// \throws std::out_of_range if there is no such vertex.
+    VertexId getId(const Vertex& v) const
+    {
+        const std::size_t id = findId(v);
+        if (id == _vertices.size())
+            throw std::out_of_range("Unknown vertex of a bottleneck tree");
+
+        return static_cast<VertexId>(id);
+    }
+
+    /// Returns the depth of the vertex with the id \a v in its tree.
+    VertexId getDepth(VertexId v) const { return _depths[v]; }
+
+    /// Returns the number of levels of jumps, i.e. the number of bits of the
+    /// height of the trees.
+    std::size_t getLevelsNum() const { return _levels; }
+
+public:
+    // Queries.
+
+    /// \brief Puts the max label on the path between the vertices \a u and
+    /// \a v to \a lbl; returns false if there is no path with edges, i.e. the
+    /// vertices are the same or in different trees.
+    ///
+    /// \throws std::out_of_range if there is no such vertex.
+    bool getBottleneck(const Vertex& u, const Vertex& v, EdgeLbl& lbl) const
+    {
+        return getBottleneckOfIds(getId(u), getId(v), lbl);
+    }
+
+    /// Puts the max label on the path between the vertices with the ids \a u
+    /// and \a v to \a lbl; returns false if there is no path with edges.
+    bool getBottleneckOfIds(VertexId u, VertexId v, EdgeLbl& lbl) const
+    {
+        if (u == v || _roots[u] != _roots[v])
+            return false;
+
+        if (_depths[u] < _depths[v])
+            std::swap(u, v);
+
+        // u is deeper and is not the LCA, so the edge to its parent is on
+        // the path
+        const std::size_t n = _vertices.size();
+        EdgeLbl res = _jumps[u].max;
+        std::size_t k = 0;
+        for (VertexId diff = _depths[u] - _depths[v]; diff; diff >>= 1, ++k)
+        {
+            if (diff & 1)
+            {
+                const Jump& j = _jumps[k * n + u];
+                res = getMax(res, j.max);
+                u = j.to;
+            }
+        }
+
+        if (u != v)
+        {
+            for (k = _levels; k > 0; --k)
+            {
+                const Jump& ju = _jumps[(k - 1) * n + u];
+                const Jump& jv = _jumps[(k - 1) * n + v];
+                if (ju.to != jv.to)
+                {
+                    res = getMax(res, getMax(ju.max, jv.max));
+                    u = ju.to;
+                    v = jv.to;
+                }
+            }
+            res = getMax(res, getMax(_jumps[u].max, _jumps[v].max));
+        }
+        lbl = res;
+
+        return true;
+    }
+
+    /// \brief Answers the \a queries: puts the bottleneck of queries[i] (see
+    /// getBottleneck()) to res[i] or infinity (see WeightTraits) if there is
+    /// no path with edges.
+    ///
+    /// If \a pool is not null, queries are split into chunks of at least
+    /// \a minGrain ones answered in parallel.
+    /// \throws std::out_of_range if there is no such vertex.
+    void getBottlenecks(const std::vector<Query>& queries, std::vector<EdgeLbl>& res,
+                        WorkStealingPool* pool = nullptr, std::size_t minGrain = 4096) const
+    {
+        answer(queries, res, pool, minGrain, [this](const Query& q)
+        {
+            return IdQuery(getId(q.first), getId(q.second));
+        });
+    }
+
+    /// Answers the \a queries of ids of vertices; see getBottlenecks().
+    void getBottlenecksOfIds(const std::vector<IdQuery>& queries, std::vector<EdgeLbl>& res,
+                             WorkStealingPool* pool = nullptr, std::size_t minGrain = 4096) const
+    {
+        answer(queries, res, pool, minGrain, [](const IdQuery& q) { return q; });
+    }
+
+protected:
+    /// Ancestor 2^k levels up with the max label on the way to it.
+    struct Jump {
+        VertexId to;
+        EdgeLbl max;
+    };
+
+protected:
+    /// Returns the greater of labels \a a and \a b.
+    static EdgeLbl getMax(const EdgeLbl& a, const EdgeLbl& b)
+    {
+        typename TWeightTraits::Compare less;
+        return less(a, b) ? b : a;
+    }
+
+    /// Returns the id of the vertex \a v or the number of vertices if there is
+    /// no such vertex.
+    std::size_t findId(const Vertex& v) const
+    {
+        typename std::vector<Vertex>::const_iterator it
+            = std::lower_bound(_vertices.begin(), _vertices.end(), v);
+        if (it == _vertices.end() || v < *it)
+            return _vertices.size();
+
+        return static_cast<std::size_t>(it - _vertices.begin());
+    }
+
+    /// Answers the \a queries whose ids are given by toIds(query).
+    template <typename TQuery, typename TToIds>
+    void answer(const std::vector<TQuery>& queries, std::vector<EdgeLbl>& res,
+                WorkStealingPool* pool, std::size_t minGrain, TToIds toIds) const
+    {
+        res.resize(queries.size());
+        auto run = [&](std::size_t from, std::size_t to)
+        {
+            for (std::size_t i = from; i < to; ++i)
+            {
+                const IdQuery q = toIds(queries[i]);
+                if (!getBottleneckOfIds(q.first, q.second, res[i]))
+                    res[i] = TWeightTraits::infinity();
+            }
+        };
+
+        if (pool && queries.size() > minGrain)
+            pool->parallelFor(0, queries.size(), pool->suggestGrain(queries.size(), minGrain), run);
+        else
+            run(0, queries.size());
+    }
+
+protected:
+    std::vector<Vertex> _vertices;          ///< Vertices in ascending order.
+    std::vector<VertexId> _depths;          ///< Depths of vertices.
+    std::vector<VertexId> _roots;           ///< Roots of the trees of vertices.
+    std::size_t _levels;                    ///< Number of levels of jumps.
+    std::vector<Jump> _jumps;               ///< Jumps of all vertices by levels.
+}; // class BottleneckTree
+
+template <typename Vertex, typename EdgeLbl, typename TWeightTraits>
+const VertexId BottleneckTree<Vertex, EdgeLbl, TWeightTraits>::NoVertex;
+
+
+/// Builds a bottleneck tree of the given graph or snapshot \a g by its MST
+/// found by findMSTPrim().
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl>,
+          template<typename, typename> class TGraph>
+BottleneckTree<Vertex, EdgeLbl, TWeightTraits> makeBottleneckTree(const TGraph<Vertex, EdgeLbl>& g)
+{
+    typedef typename TGraph<Vertex, EdgeLbl>::Edge Edge;
+
+    const std::set<Edge> mst = findMSTPrim<Vertex, EdgeLbl, TWeightTraits>(g);
+    std::vector<LblEdge<Vertex, EdgeLbl> > edges;
+    edges.reserve(mst.size());
+    for (const Edge& e : mst)
+    {
+        LblEdge<Vertex, EdgeLbl> le = {e.first, e.second, EdgeLbl()};
+        g.getLabel(e.first, e.second, le.lbl);
+        edges.push_back(le);
+    }
+
+    std::vector<Vertex> vertices;
+    vertices.reserve(g.getVerticesNum());
+    auto range = g.getVertices();
+    vertices.insert(vertices.end(), range.first, range.second);
+
+    return BottleneckTree<Vertex, EdgeLbl, TWeightTraits>(std::move(vertices), edges);
+}
+
+
+
+#endif // BOTTLENECK_TREE_HPP
@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains functions for storing CSR snapshots of labeled graphs in
+///             binary files and for mapping such files into memory.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+/// The file format (version 1) uses the native byte order and consists of:
+///   - a 64-byte header (see CsrFileHeader);
+///   - V vertices;
+///   - V + 1 offsets of 8 bytes each;
+///   - 2E adjacency entries (CsrSnapshot::AdjEntry).
+/// Every section starts at a multiple of 64 bytes, so a mapped file can be
+/// used as a snapshot directly, without parsing and copying.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CSR_FILE_HPP
+#define CSR_FILE_HPP
+
+#include <string>
+#include <memory>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CSR_FILE_USE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "csr_snapshot.hpp"
+
+
+/// Header of a binary file with a CSR snapshot.
+struct CsrFileHeader {
+    char magic[8];                  ///< "UGRCSR\0\0".
+    std::uint32_t version;          ///< Format version.
+    std::uint32_t byteOrder;        ///< 0x01020304 written natively.
+    std::uint32_t vertexSize;       ///< sizeof(Vertex).
+    std::uint32_t lblSize;          ///< sizeof(EdgeLbl).
+    std::uint32_t entrySize;        ///< sizeof(AdjEntry).
+    std::uint32_t reserved;
+    std::uint64_t verticesNum;      ///< V.
+    std::uint64_t adjEntriesNum;    ///< 2E.
+    std::uint64_t offsetsPos;       ///< Position of offsets in the file.
+    std::uint64_t adjPos;           ///< Position of adjacency entries.
+};
+
+static_assert(sizeof(CsrFileHeader) == 64, "CSR file header must take 64 bytes");
+
+
+/// Alignment of sections of a binary file with a CSR snapshot.
+const std::uint64_t CSR_FILE_ALIGN = 64;
+
+/// Current version of the format of binary files with CSR snapshots.
+const std::uint32_t CSR_FILE_VERSION = 1;
+
+
+/// Makes a header of a file for a snapshot with \a verticesNum vertices and
+/// \a adjEntriesNum adjacency entries.
+template <typename Vertex, typename EdgeLbl>
+CsrFileHeader makeCsrFileHeader(std::uint64_t verticesNum, std::uint64_t adjEntriesNum)
+{
+    typedef CsrSnapshot<Vertex, EdgeLbl> Snapshot;
+
+    auto align = [](std::uint64_t pos)
+    {
+        return (pos + CSR_FILE_ALIGN - 1) / CSR_FILE_ALIGN * CSR_FILE_ALIGN;
+    };
+
+    CsrFileHeader h;
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, "UGRCSR\0\0", 8);
+    h.version = CSR_FILE_VERSION;
+    h.byteOrder = 0x01020304;
+    h.vertexSize = sizeof(Vertex);
+    h.lblSize = sizeof(EdgeLbl);
+    h.entrySize = sizeof(typename Snapshot::AdjEntry);
+    h.verticesNum = verticesNum;
+    h.adjEntriesNum = adjEntriesNum;
+    h.offsetsPos = align(sizeof(CsrFileHeader) + h.verticesNum * sizeof(Vertex));
+    h.adjPos = align(h.offsetsPos + (h.verticesNum + 1) * sizeof(typename Snapshot::Offset));
+
+    return h;
+}
+
+
+/// Writes the snapshot \a sn to the binary file with the name \a fn.
+///
+/// Vertices and labels are written as they are in memory, so their types must
+/// be trivially copyable.
+template <typename Vertex, typename EdgeLbl>
+void writeCsrSnapshot(const std::string& fn, const CsrSnapshot<Vertex, EdgeLbl>& sn)
+{
+    typedef CsrSnapshot<Vertex, EdgeLbl> Snapshot;
+    static_assert(std::is_trivially_copyable<Vertex>::value,
+                  "Vertex must be trivially copyable to be stored in a binary file");
+    static_assert(std::is_trivially_copyable<EdgeLbl>::value,
+                  "EdgeLbl must be trivially copyable to be stored in a binary file");
+
+    std::ofstream f(fn.c_str(), std::ios::binary | std::ios::trunc);
+    if (!f.is_open())
+        throw std::invalid_argument("Can't open a CSR file for writing");
+
+    const CsrFileHeader h = makeCsrFileHeader<Vertex, EdgeLbl>(sn.getVerticesNum(),
+                                                               sn.getAdjEntriesNum());
+    const char zeros[CSR_FILE_ALIGN] = {};
+    std::uint64_t pos = 0;
+
+    auto writeAt = [&](std::uint64_t at, const void* data, std::uint64_t len)
+    {
+        f.write(zeros, static_cast<std::streamsize>(at - pos));    // padding
+        f.write(static_cast<const char*>(data), static_cast<std::streamsize>(len));
+        pos = at + len;
+    };
+
+    writeAt(0, &h, sizeof(h));
+    writeAt(sizeof(h), sn.getVerticesData(), h.verticesNum * sizeof(Vertex));
+    writeAt(h.offsetsPos, sn.getOffsetsData(),
+            (h.verticesNum + 1) * sizeof(typename Snapshot::Offset));
+    writeAt(h.adjPos, sn.getAdjData(),
+            h.adjEntriesNum * sizeof(typename Snapshot::AdjEntry));
+
+    f.flush();
+    if (!f)
+        throw std::runtime_error("Can't write a CSR file");
+}
+
+
+/// Block of memory holding the content of a file.
+class CsrFileMapping {
+public:
+    /// Maps the file with the name \a fn into memory for reading.
+    explicit CsrFileMapping(const std::string& fn)
+        : _data(nullptr)
+        , _size(0)
+    {
+#ifdef CSR_FILE_USE_MMAP
+        int fd = ::open(fn.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::invalid_argument("Can't open a CSR file");
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Can't get the size of a CSR file");
+        }
+
+        _size = static_cast<std::size_t>(st.st_size);
+        if (_size)
+        {
+            void* p = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("Can't map a CSR file");
+            }
+            _data = static_cast<const char*>(p);
+        }
+        ::close(fd);                    // the mapping stays valid
+#else
+        // no mmap: the file is read into memory
+        std::ifstream f(fn.c_str(), std::ios::binary | std::ios::ate);
+        if (!f.is_open())
+            throw std::invalid_argument("Can't open a CSR file");
+
+        _size = static_cast<std::size_t>(f.tellg());
+        _buf.resize((_size + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+        f.seekg(0);
+        f.read(reinterpret_cast<char*>(_buf.data()), static_cast<std::streamsize>(_size));
+        if (!f)
+            throw std::runtime_error("Can't read a CSR file");
+        _data = reinterpret_cast<const char*>(_buf.data());
+#endif
+    }
+
+    ~CsrFileMapping()
+    {
+#ifdef CSR_FILE_USE_MMAP
+        if (_data)
+            ::munmap(const_cast<char*>(_data), _size);
+#endif
+    }
+
+    CsrFileMapping(const CsrFileMapping&) = delete;
+    CsrFileMapping& operator=(const CsrFileMapping&) = delete;
+
+    const char* getData() const { return _data; }
+    std::size_t getSize() const { return _size; }
+
+protected:
+    const char* _data;                  ///< Content of the file.
+    std::size_t _size;                  ///< Size of the file.
+#ifndef CSR_FILE_USE_MMAP
+    std::vector<std::uint64_t> _buf;    ///< Aligned buffer for the content.
+#endif
+}; // class CsrFileMapping
+
+
+/// \brief Maps the binary file with the name \a fn written by writeCsrSnapshot()
+/// into memory and returns a snapshot over it.
+///
+/// The header is always validated; sizes in it are checked against the size of
+/// the file before any arithmetic, so a corrupted header can't make a snapshot
+/// reach out of the file. Unless \a isTrusted is set, the content is validated
+/// too in O(V + E) time: offsets must grow from 0 to the number of adjacency
+/// entries, and neighbours must be valid vertex ids. A trusted file (e.g. one
+/// just written by this process) is mapped in O(1) time: the content is neither
+/// read nor copied, pages are loaded by the OS on first access, and corrupted
+/// content leads to undefined behavior.
+///
+/// The file must not be changed while the snapshot (or any its copy) exists.
+///
+/// \throws std::invalid_argument if the file can't be opened or is not a valid
+/// CSR file for the given types.
+template <typename Vertex, typename EdgeLbl>
+CsrSnapshot<Vertex, EdgeLbl> mapCsrSnapshot(const std::string& fn, bool isTrusted = false)
+{
+    typedef CsrSnapshot<Vertex, EdgeLbl> Snapshot;
+    typedef typename Snapshot::Offset Offset;
+    typedef typename Snapshot::AdjEntry AdjEntry;
+
+    std::shared_ptr<CsrFileMapping> file = std::make_shared<CsrFileMapping>(fn);
+    const std::uint64_t size = file->getSize();
+    if (size < sizeof(CsrFileHeader))
+        throw std::invalid_argument("CSR file is too short");
+
+    CsrFileHeader h;
+    std::memcpy(&h, file->getData(), sizeof(h));
+    if (std::memcmp(h.magic, "UGRCSR\0\0", 8) != 0)
+        throw std::invalid_argument("Not a CSR file");
+    if (h.version != CSR_FILE_VERSION)
+        throw std::invalid_argument("Unsupported version of a CSR file");
+    if (h.byteOrder != 0x01020304)
+        throw std::invalid_argument("CSR file has a different byte order");
+    if (h.vertexSize != sizeof(Vertex) || h.lblSize != sizeof(EdgeLbl)
+        || h.entrySize != sizeof(AdjEntry))
+        throw std::invalid_argument("CSR file was written for other types");
+
+    // every section fits into the file, so the positions computed below don't
+    // overflow; ids of vertices must fit into VertexId
+    if (h.verticesNum >= size / sizeof(Offset) || h.verticesNum > size / sizeof(Vertex)
+        || h.verticesNum >= VertexIndex<Vertex>::NoId
+        || h.adjEntriesNum > size / sizeof(AdjEntry))
+        throw std::invalid_argument("CSR file is corrupted");
+
+    // the rest of the header is determined by the sizes
+    const CsrFileHeader expected = makeCsrFileHeader<Vertex, EdgeLbl>(h.verticesNum,
+                                                                      h.adjEntriesNum);
+    if (std::memcmp(&h, &expected, sizeof(h)) != 0
+        || h.adjPos > size || size - h.adjPos < h.adjEntriesNum * sizeof(AdjEntry))
+        throw std::invalid_argument("CSR file is corrupted");
+
+    const char* data = file->getData();
+    const std::size_t n = static_cast<std::size_t>(h.verticesNum);
+    const Offset* offsets = reinterpret_cast<const Offset*>(data + h.offsetsPos);
+    const AdjEntry* adj = reinterpret_cast<const AdjEntry*>(data + h.adjPos);
+    if (offsets[n] != h.adjEntriesNum)
+        throw std::invalid_argument("CSR file is corrupted");
+
+    if (!isTrusted)
+    {
+        if (offsets[0] != 0)
+            throw std::invalid_argument("CSR file is corrupted");
+        for (std::size_t i = 0; i < n; ++i)
+            if (offsets[i + 1] < offsets[i])
+                throw std::invalid_argument("CSR file is corrupted");
+        for (std::size_t i = 0; i < h.adjEntriesNum; ++i)
+            if (adj[i].vertex >= n)
+                throw std::invalid_argument("CSR file is corrupted");
+    }
+
+    return Snapshot(file, reinterpret_cast<const Vertex*>(data + sizeof(CsrFileHeader)),
+                    n, offsets, adj);
+}
+
+
+
+#endif // CSR_FILE_HPP
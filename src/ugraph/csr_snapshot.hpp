@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for immutable compact
+///             snapshots of labeled undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CSR_SNAPSHOT_HPP
+#define CSR_SNAPSHOT_HPP
+
+#include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+#include "vertex_index.hpp"
+
+
+/*! ****************************************************************************
+ *  \brief The CsrSnapshot class represents a read-only labeled undirected graph
+ *  stored in the compressed sparse row (CSR) form.
+ *
+ *  Vertices are sorted and numbered by dense ids 0..V-1 in the same way as
+ *  VertexIndex numbers them. The adjacency of the vertex with id i occupies
+ *  the range [offsets[i], offsets[i + 1]) of a single array, and every entry of
+ *  it keeps a neighbour id together with the edge label. As in UGraph, every
+ *  edge is stored twice (once for each of its vertices); entries of each vertex
+ *  are sorted by neighbour ids.
+ *
+ *  Snapshots are immutable, so copies share the same storage. The storage is
+ *  either owned arrays or an external memory block (see csr_file.hpp).
+ *
+ *  \tparam Vertex represents a type for vertices. See requirements for UGraph.
+ *  \tparam EdgeLbl represents a type for edge labeling.
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl>
+class CsrSnapshot {
+public:
+    // type definitions
+
+    typedef std::pair<Vertex, Vertex> Edge;
+
+    /// Dense id of a vertex.
+    typedef ::VertexId VertexId;
+
+    /// Position in the adjacency array.
+    typedef std::uint64_t Offset;
+
+    /// Entry of the adjacency array: a neighbour and a label of the edge
+    /// leading to it.
+    struct AdjEntry {
+        VertexId vertex;            ///< Id of the neighbour.
+        EdgeLbl lbl;                ///< Label of the edge (if any).
+        bool hasLbl;                ///< Whether the edge is labeled.
+    };
+
+    typedef const AdjEntry* AdjCIter;
+    typedef std::pair<AdjCIter, AdjCIter> AdjCIterPair;
+
+public:
+    /// Creates an empty snapshot.
+    CsrSnapshot()
+        : CsrSnapshot(std::vector<Vertex>(), std::vector<Offset>(1, 0),
+                      std::vector<AdjEntry>())
+    {
+    }
+
+    /// Creates a snapshot by taking ownership of the given arrays.
+    ///
+    /// \a vertices must be sorted, \a offsets must consist of
+    /// vertices.size() + 1 nondecreasing values starting with 0 and ending with
+    /// adj.size().
+    CsrSnapshot(std::vector<Vertex>&& vertices, std::vector<Offset>&& offsets,
+                std::vector<AdjEntry>&& adj)
+    {
+        if (vertices.size() >= VertexIndex<Vertex>::NoId)
+            throw std::length_error("Too many vertices for a CSR snapshot");
+        if (offsets.size() != vertices.size() + 1 || offsets.front() != 0
+            || offsets.back() != adj.size())
+            throw std::invalid_argument("Inconsistent CSR offsets");
+
+        std::shared_ptr<Storage> st = std::make_shared<Storage>();
+        st->vertices = std::move(vertices);
+        st->offsets = std::move(offsets);
+        st->adj = std::move(adj);
+
+        _vertices = st->vertices.data();
+        _offsets = st->offsets.data();
+        _adj = st->adj.data();
+        _verticesNum = st->vertices.size();
+        _storage = st;
+    }
+
+    /// Creates a snapshot over arrays that are kept alive by the \a storage
+    /// object, e.g. a memory-mapped file. The arrays must satisfy the same
+    /// requirements as for the previous constructor, only the sizes are
+    /// checked here.
+    CsrSnapshot(std::shared_ptr<const void> storage, const Vertex* vertices,
+                std::size_t verticesNum, const Offset* offsets, const AdjEntry* adj)
+        : _storage(std::move(storage))
+        , _vertices(vertices)
+        , _offsets(offsets)
+        , _adj(adj)
+        , _verticesNum(verticesNum)
+    {
+        if (verticesNum >= VertexIndex<Vertex>::NoId)
+            throw std::length_error("Too many vertices for a CSR snapshot");
+        if (offsets[0] != 0)
+            throw std::invalid_argument("Inconsistent CSR offsets");
+    }
+
+public:
+    // setters/getters
+    std::size_t getVerticesNum() const { return _verticesNum; }
+    std::size_t getEdgesNum() const { return _offsets[_verticesNum] / 2; }
+
+    /// Returns the number of adjacency entries (twice the number of edges).
+    std::size_t getAdjEntriesNum() const { return _offsets[_verticesNum]; }
+
+    /// Raw arrays of the snapshot, see the class description.
+    const Vertex* getVerticesData() const { return _vertices; }
+    const Offset* getOffsetsData() const { return _offsets; }
+    const AdjEntry* getAdjData() const { return _adj; }
+
+    /// Returns the vertex with the dense id \a id.
+    const Vertex& getVertex(VertexId id) const { return _vertices[id]; }
+
+    /// Provides all the vertices, sorted, as a semirange.
+    std::pair<const Vertex*, const Vertex*> getVertices() const
+    {
+        return {_vertices, _vertices + _verticesNum};
+    }
+
+    /// Looks for the dense id of the vertex \a v.
+    ///
+    /// \return true if the vertex exists and \a id is assigned to its id;
+    /// false otherwise.
+    bool findVertexId(const Vertex& v, VertexId& id) const
+    {
+        const Vertex* end = _vertices + _verticesNum;
+        const Vertex* it = std::lower_bound(_vertices, end, v);
+        if (it == end || v < *it)
+            return false;
+
+        id = static_cast<VertexId>(it - _vertices);
+        return true;
+    }
+
+    bool isVertexExists(const Vertex& v) const
+    {
+        VertexId id;
+        return findVertexId(v, id);
+    }
+
+    /// Returns a range of adjacency entries of the vertex with the id \a id.
+    AdjCIterPair getAdjEdges(VertexId id) const
+    {
+        return {_adj + _offsets[id], _adj + _offsets[id + 1]};
+    }
+
+    /// Returns the number of adjacency entries of the vertex with the id \a id.
+    std::size_t getDegree(VertexId id) const
+    {
+        return static_cast<std::size_t>(_offsets[id + 1] - _offsets[id]);
+    }
+
+    /// For the edge {s, d} tries to find an associated label and returns it
+    /// if so. Semantics is the same as for EdgeLblUGraph::getLabel().
+    bool getLabel(const Vertex& s, const Vertex& d, EdgeLbl& lbl) const
+    {
+        VertexId sid, did;
+        if (!findVertexId(s, sid) || !findVertexId(d, did))
+            return false;
+
+        AdjCIterPair range = getAdjEdges(sid);
+        AdjCIter it = std::lower_bound(range.first, range.second, did,
+            [](const AdjEntry& e, VertexId id) { return e.vertex < id; });
+        if (it == range.second || it->vertex != did || !it->hasLbl)
+            return false;
+
+        lbl = it->lbl;
+        return true;
+    }
+
+protected:
+    /// Owned arrays of a snapshot.
+    struct Storage {
+        std::vector<Vertex> vertices;
+        std::vector<Offset> offsets;
+        std::vector<AdjEntry> adj;
+    };
+
+protected:
+    std::shared_ptr<const void> _storage;   ///< Keeps the arrays alive.
+    const Vertex* _vertices;                ///< Sorted vertices.
+    const Offset* _offsets;                 ///< V + 1 offsets in _adj.
+    const AdjEntry* _adj;                   ///< Adjacency entries.
+    std::size_t _verticesNum;               ///< Number of vertices.
+}; // class CsrSnapshot
+
+
+#endif // CSR_SNAPSHOT_HPP
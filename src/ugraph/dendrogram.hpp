@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a single-linkage dendrogram built from a minimum
+///             spanning forest.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DENDROGRAM_HPP
+#define DENDROGRAM_HPP
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+#include "ugraph_algos.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief The Dendrogram class represents the hierarchy of single-linkage
+ *  clusters of vertices given by a minimum spanning forest.
+ *
+ *  Nodes 0..n-1 are the vertices in ascending order; the node n + i is the i-th
+ *  merge. Merges are made by taking the edges of the forest in the order of
+ *  Kruskal's algorithm and uniting the clusters of their ends, so heights of
+ *  merges never decrease. Clusters at any threshold or of any number are thus
+ *  given by a prefix of the merges and are found in O(V) time.
+ *
+ *  A node takes 4 bytes in a few arrays, so tens of millions of vertices fit
+ *  easily.
+ *
+ *  \tparam Vertex represents a type for vertices.
+ *  \tparam EdgeLbl represents a type for edge labels.
+ *  \tparam TWeightTraits describes labels as weights (see WeightTraits).
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+class Dendrogram {
+public:
+    // type definitions
+
+    /// Node of the dendrogram.
+    typedef std::uint32_t Node;
+
+    /// Denotes the absent parent of a root.
+    static const Node NoNode = static_cast<Node>(-1);
+
+    /// Merge of two clusters.
+    struct Merge {
+        Node left;                  ///< Lesser of the merged nodes.
+        Node right;                 ///< Greater of the merged nodes.
+        EdgeLbl height;             ///< Label of the edge that merges them.
+        Node size;                  ///< Number of vertices in the cluster.
+    };
+
+public:
+    /// \brief Builds a dendrogram of the \a vertices (in any order, duplicates
+    /// are ignored) by the \a edges of their minimum spanning forest, e.g.
+    /// MSTEdges::edges.
+    ///
+    /// \throws std::invalid_argument if an edge has an unknown vertex or the
+    /// edges make a cycle.
+    /// \throws std::length_error if there are too many vertices.
+    Dendrogram(std::vector<Vertex> vertices,
+               const std::vector<LblEdge<Vertex, EdgeLbl> >& edges)
+        : _vertices(std::move(vertices))
+    {
+        std::sort(_vertices.begin(), _vertices.end());
+        _vertices.erase(std::unique(_vertices.begin(), _vertices.end(),
+                                    [](const Vertex& a, const Vertex& b)
+                                    {
+                                        return !(a < b) && !(b < a);
+                                    }),
+                        _vertices.end());
+        const std::size_t n = _vertices.size();
+        if (n > NoNode / 2)
+            throw std::length_error("Too many vertices for a dendrogram");
+
+        std::vector<IdEdge<EdgeLbl> > ids;
+        ids.reserve(edges.size());
+        for (const LblEdge<Vertex, EdgeLbl>& e : edges)
+        {
+            VertexId s = getId(e.s), d = getId(e.d);
+            if (d < s)
+                std::swap(s, d);
+            IdEdge<EdgeLbl> ie = {s, d, e.lbl};
+            ids.push_back(ie);
+        }
+        sortIdEdges<TWeightTraits>(ids.begin(), ids.end());
+
+        // tops of the clusters by their representatives
+        DisjointSet clusters(n);
+        std::vector<Node> tops(n);
+        for (std::size_t v = 0; v < n; ++v)
+            tops[v] = static_cast<Node>(v);
+        _parents.assign(n + ids.size(), NoNode);
+        _merges.reserve(ids.size());
+
+        for (const IdEdge<EdgeLbl>& e : ids)
+        {
+            const std::size_t a = clusters.find(e.s);
+            const std::size_t b = clusters.find(e.d);
+            if (!clusters.unite(a, b))
+                throw std::invalid_argument("Edges of a dendrogram must not make a cycle");
+
+            const Node node = static_cast<Node>(n + _merges.size());
+            Merge m = {std::min(tops[a], tops[b]), std::max(tops[a], tops[b]), e.lbl,
+                       getSize(tops[a]) + getSize(tops[b])};
+            _merges.push_back(m);
+            _parents[tops[a]] = _parents[tops[b]] = node;
+            tops[clusters.find(a)] = node;
+        }
+    }
+
+public:
+    // setters/getters
+
+    /// Returns the number of vertices.
+    std::size_t getVerticesNum() const { return _vertices.size(); }
+
+    /// Returns the vertex of the node \a v < getVerticesNum().
+    const Vertex& getVertex(std::size_t v) const { return _vertices[v]; }
+
+    /// Returns the merges in the order they are made.
+    const std::vector<Merge>& getMerges() const { return _merges; }
+
+    /// Returns the parent of the \a node or NoNode for a root.
+    Node getParent(Node node) const { return _parents[node]; }
+
+    /// Returns the number of vertices under the \a node.
+    Node getSize(Node node) const
+    {
+        return node < _vertices.size() ? 1 : _merges[node - _vertices.size()].size;
+    }
+
+    /// Returns the least number of clusters, i.e. the number of trees of the
+    /// forest.
+    std::size_t getMinClustersNum() const { return _vertices.size() - _merges.size(); }
+
+public:
+    // Queries.
+
+    /// \brief Puts to \a labels the clusters of vertices (in the order of
+    /// nodes) made by the merges not higher than \a t; returns the number of
+    /// clusters.
+    ///
+    /// Clusters are numbered in the order of their least vertices.
+    std::size_t getClustersAt(const EdgeLbl& t, std::vector<std::size_t>& labels) const
+    {
+        typename TWeightTraits::Compare less;
+        const std::size_t p = std::upper_bound(_merges.begin(), _merges.end(), t,
+                                               [less](const EdgeLbl& x, const Merge& m)
+                                               {
+                                                   return less(x, m.height);
+                                               })
+                              - _merges.begin();
+
+        return cut(p, labels);
+    }
+
+    /// \brief Puts to \a labels the \a k clusters of vertices (in the order of
+    /// nodes) made by the first merges; clusters are numbered in the order of
+    /// their least vertices. Returns \a k.
+    ///
+    /// \throws std::out_of_range if \a k is less than getMinClustersNum() or
+    /// greater than the number of vertices.
+    std::size_t getClusters(std::size_t k, std::vector<std::size_t>& labels) const
+    {
+        if (k < getMinClustersNum() || k > _vertices.size())
+            throw std::out_of_range("Wrong number of clusters");
+
+        return cut(_vertices.size() - k, labels);
+    }
+
+protected:
+    /// Returns the node of the vertex \a v.
+    VertexId getId(const Vertex& v) const
+    {
+        typename std::vector<Vertex>::const_iterator it
+            = std::lower_bound(_vertices.begin(), _vertices.end(), v);
+        if (it == _vertices.end() || v < *it)
+            throw std::invalid_argument("Edge of a dendrogram has an unknown vertex");
+
+        return static_cast<VertexId>(it - _vertices.begin());
+    }
+
+    /// Puts to \a labels the clusters made by the first \a p merges; returns
+    /// the number of clusters.
+    std::size_t cut(std::size_t p, std::vector<std::size_t>& labels) const
+    {
+        const std::size_t n = _vertices.size();
+        const std::size_t NoLabel = static_cast<std::size_t>(-1);
+
+        // parents go after children, so tops of the clusters are labeled
+        // first and their labels go down
+        std::vector<Node> mergeLabels(p);
+        labels.resize(n);
+        std::size_t clustersNum = 0;
+        auto labelOf = [&](Node node) -> std::size_t
+        {
+            const Node parent = _parents[node];
+            if (parent != NoNode && parent - n < p)
+                return mergeLabels[parent - n];
+
+            return clustersNum++;
+        };
+        for (std::size_t i = p; i > 0; --i)
+            mergeLabels[i - 1] = static_cast<Node>(labelOf(static_cast<Node>(n + i - 1)));
+        for (std::size_t v = 0; v < n; ++v)
+            labels[v] = labelOf(static_cast<Node>(v));
+
+        // clusters are renumbered in the order of their least vertices
+        std::vector<std::size_t> order(clustersNum, NoLabel);
+        std::size_t next = 0;
+        for (std::size_t v = 0; v < n; ++v)
+        {
+            std::size_t& o = order[labels[v]];
+            if (o == NoLabel)
+                o = next++;
+            labels[v] = o;
+        }
+
+        return clustersNum;
+    }
+
+protected:
+    std::vector<Vertex> _vertices;          ///< Vertices in ascending order.
+    std::vector<Merge> _merges;             ///< Merges in the order of heights.
+    std::vector<Node> _parents;             ///< Parents of nodes.
+}; // class Dendrogram
+
+template <typename Vertex, typename EdgeLbl, typename TWeightTraits>
+const typename Dendrogram<Vertex, EdgeLbl, TWeightTraits>::Node
+    Dendrogram<Vertex, EdgeLbl, TWeightTraits>::NoNode;
+
+
+/// Builds a single-linkage dendrogram of the vertices of the given graph or
+/// snapshot \a g by its MST found by findMSTEdges().
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl>,
+          template<typename, typename> class TGraph>
+Dendrogram<Vertex, EdgeLbl, TWeightTraits> makeDendrogram(const TGraph<Vertex, EdgeLbl>& g)
+{
+    MSTEdges<Vertex, EdgeLbl> mst = findMSTEdges<Vertex, EdgeLbl, TWeightTraits>(g);
+    std::vector<Vertex> vertices;
+    vertices.reserve(g.getVerticesNum());
+    auto range = g.getVertices();
+    vertices.insert(vertices.end(), range.first, range.second);
+
+    return Dendrogram<Vertex, EdgeLbl, TWeightTraits>(std::move(vertices), mst.edges);
+}
+
+
+
+#endif // DENDROGRAM_HPP
@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a disjoint-set (union-find) structure used by the graph
+///             algorithms.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DISJOINT_SET_HPP
+#define DISJOINT_SET_HPP
+
+#include <vector>
+#include <utility>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+
+
+/*! ****************************************************************************
+ *  \brief The DisjointSet class represents a partition of elements 0..n-1 into
+ *  disjoint sets.
+ *
+ *  Uses union by rank and path halving, so a sequence of m operations takes
+ *  O(m α(n)) time. Parents and ranks are kept in flat arrays.
+ ******************************************************************************/
+class DisjointSet {
+public:
+    /// Element of a set.
+    typedef std::size_t Elem;
+
+public:
+    /// Creates \a n singleton sets {0}, {1}, ..., {n-1}.
+    explicit DisjointSet(std::size_t n = 0)
+    {
+        reset(n);
+    }
+
+    /// Makes \a n singleton sets again; reallocates memory only if \a n grows.
+    void reset(std::size_t n)
+    {
+        _parents.resize(n);
+        _ranks.assign(n, 0);
+        for (std::size_t i = 0; i < n; ++i)
+            _parents[i] = i;
+        _setsNum = n;
+    }
+
+    /// Adds a new singleton set {n} where n is the current size; returns n.
+    Elem addElem()
+    {
+        const Elem x = _parents.size();
+        _parents.push_back(x);
+        _ranks.push_back(0);
+        ++_setsNum;
+
+        return x;
+    }
+
+public:
+    // setters/getters
+    std::size_t getSize() const { return _parents.size(); }
+    std::size_t getSetsNum() const { return _setsNum; }
+
+    /// Returns the representative of the set the element \a x belongs to.
+    Elem find(Elem x)
+    {
+        // path halving: every other node on the path skips its parent
+        while (_parents[x] != x)
+        {
+            _parents[x] = _parents[_parents[x]];
+            x = _parents[x];
+        }
+
+        return x;
+    }
+
+    /// Determines whether elements \a a and \a b belong to the same set.
+    bool isSameSet(Elem a, Elem b)
+    {
+        return find(a) == find(b);
+    }
+
+    /// Merges the sets of the elements \a a and \a b.
+    ///
+    /// \return true if the sets have been merged, false if \a a and \a b are
+    /// already in the same set.
+    bool unite(Elem a, Elem b)
+    {
+        a = find(a);
+        b = find(b);
+        if (a == b)
+            return false;
+
+        if (_ranks[a] < _ranks[b])
+            std::swap(a, b);
+        _parents[b] = a;
+        if (_ranks[a] == _ranks[b])
+            ++_ranks[a];
+
+        --_setsNum;
+        return true;
+    }
+
+protected:
+    std::vector<Elem> _parents;             ///< Parents of elements in trees.
+    std::vector<unsigned char> _ranks;      ///< Upper bounds of trees heights.
+    std::size_t _setsNum;                   ///< Number of sets.
+}; // class DisjointSet
+
+
+
+/*! ****************************************************************************
+ *  \brief The ConcurrentDisjointSet class represents a partition of elements
+ *  0..n-1 into disjoint sets that can be changed by several threads at once.
+ *
+ *  Parents are atomics changed by compare-and-swap: find() halves paths and
+ *  unite() links the root with the smaller index under the root with the
+ *  greater one, so trees never get cycles. All the operations are lock-free.
+ ******************************************************************************/
+class ConcurrentDisjointSet {
+public:
+    /// Element of a set.
+    typedef std::uint32_t Elem;
+
+public:
+    /// Creates \a n singleton sets {0}, {1}, ..., {n-1}.
+    explicit ConcurrentDisjointSet(std::size_t n = 0)
+        : _size(0)
+    {
+        reset(n);
+    }
+
+    /// Makes \a n singleton sets again; must not run concurrently with other
+    /// operations.
+    void reset(std::size_t n)
+    {
+        if (n != _size)
+        {
+            _parents.reset(n ? new std::atomic<Elem>[n] : nullptr);
+            _size = n;
+        }
+        for (std::size_t i = 0; i < n; ++i)
+            _parents[i].store(static_cast<Elem>(i), std::memory_order_relaxed);
+    }
+
+public:
+    // setters/getters
+    std::size_t getSize() const { return _size; }
+
+    /// Returns the current representative of the set the element \a x
+    /// belongs to.
+    Elem find(Elem x)
+    {
+        for (;;)
+        {
+            Elem p = _parents[x].load(std::memory_order_acquire);
+            if (p == x)
+                return x;
+
+            Elem gp = _parents[p].load(std::memory_order_acquire);
+            if (gp != p)        // path halving; fails harmlessly if x has moved
+                _parents[x].compare_exchange_weak(p, gp, std::memory_order_acq_rel);
+            x = gp;
+        }
+    }
+
+    /// Determines whether elements \a a and \a b are in the same set.
+    ///
+    /// The answer is exact if no other thread unites sets at the same time.
+    bool isSameSet(Elem a, Elem b)
+    {
+        return find(a) == find(b);
+    }
+
+    /// Merges the sets of the elements \a a and \a b.
+    ///
+    /// \return true if this call has merged the sets, false if \a a and \a b
+    /// are already in the same set.
+    bool unite(Elem a, Elem b)
+    {
+        for (;;)
+        {
+            a = find(a);
+            b = find(b);
+            if (a == b)
+                return false;
+
+            if (a > b)
+                std::swap(a, b);
+
+            // a must still be a root to be linked
+            Elem expected = a;
+            if (_parents[a].compare_exchange_strong(expected, b, std::memory_order_acq_rel))
+                return true;
+        }
+    }
+
+protected:
+    std::unique_ptr<std::atomic<Elem>[]> _parents;  ///< Parents of elements.
+    std::size_t _size;                              ///< Number of elements.
+}; // class ConcurrentDisjointSet
+
+
+
+#endif // DISJOINT_SET_HPP
@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a minimum spanning forest maintained under insertions
+///             of edges of a graph and decreases of their labels.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DYNAMIC_MST_HPP
+#define DYNAMIC_MST_HPP
+
+#include <set>
+#include <map>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+#include "lbl_ugraph.hpp"
+#include "link_cut_tree.hpp"
+#include "ugraph_algos.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief The DynamicMST class keeps a minimum spanning forest of a graph up to
+ *  date while labeled edges are added and made lighter through it.
+ *
+ *  The forest is stored in a link-cut tree with vertices as nodes without keys
+ *  and MST edges as nodes with labels between them. A new (or lighter) edge
+ *  {u, v} either links two trees or, if u and v are connected already,
+ *  replaces the heaviest edge of the tree path u..v when it is heavier than
+ *  the new one (the cycle property); both take O(log V) amortized time.
+ *
+ *  Removing an edge or making it heavier is not supported: an MST edge that
+ *  leaves needs a replacement found among all edges between the two halves of
+ *  its tree, which takes polylogarithmic time only with the levels of spanning
+ *  forests of Holm et al. Such changes are to be made to the graph directly
+ *  (see EdgeLblUGraph::removeEdge()) with a new DynamicMST attached after them.
+ *
+ *  The contract on edges is the same as for findMSTPrim(): only labeled edges
+ *  are considered and self-loops are skipped.
+ *
+ *  \tparam Vertex represents a type for vertices.
+ *  \tparam EdgeLbl represents a type for edge labels.
+ *  \tparam TWeightTraits describes labels as weights (see WeightTraits).
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+class DynamicMST {
+public:
+    // type definitions
+    typedef EdgeLblUGraph<Vertex, EdgeLbl> Graph;
+    typedef typename Graph::Edge Edge;
+    typedef LinkCutTree<EdgeLbl, typename TWeightTraits::Compare> Forest;
+    typedef typename Forest::Node Node;
+
+public:
+    /// Attaches to the graph \a g and finds its MST; the graph must be changed
+    /// only through this object afterwards, and must outlive it.
+    explicit DynamicMST(Graph& g)
+        : _g(g)
+        , _nonTreeEdgesNum(0)
+    {
+        forEachMSTEdge<Vertex, EdgeLbl, TWeightTraits>(g,
+            [this](const Vertex& u, const Vertex& v, const EdgeLbl& lbl)
+            {
+                linkEdge(Edge(u, v), getNode(u), getNode(v), lbl);
+            });
+
+        typename Graph::EdgeLabelingCIterPair lblEdges = g.getLblEdges();
+        for (typename Graph::EdgeLabelingCIter it = lblEdges.first; it != lblEdges.second; ++it)
+        {
+            if (it->first.first != it->first.second && !_treeEdges.count(it->first))
+                ++_nonTreeEdgesNum;
+        }
+    }
+
+    DynamicMST(const DynamicMST&) = delete;
+    DynamicMST& operator=(const DynamicMST&) = delete;
+
+public:
+    // Graph structure modifying methods.
+
+    /// \brief Adds the labeled edge {s, d} to the graph or makes its label
+    /// lighter (see EdgeLblUGraph::addLblEdge()) and updates the MST.
+    ///
+    /// Takes O(log V) amortized time.
+    /// \return The normalized edge.
+    /// \throws std::invalid_argument if the edge is labeled with a lighter
+    /// label already; the graph is not changed then.
+    Edge addLblEdge(Vertex s, Vertex d, EdgeLbl lbl)
+    {
+        EdgeLbl oldLbl = EdgeLbl();
+        const bool isLabeled = _g.getLabel(s, d, oldLbl);
+        if (isLabeled && _less(oldLbl, lbl))
+            throw std::invalid_argument("DynamicMST: an edge cannot get heavier");
+
+        Edge e = _g.addLblEdge(s, d, lbl);
+        if (e.first == e.second)
+            return e;                               // self-loops never get into a MST
+
+        if (!isLabeled)
+        {
+            insertEdge(e, lbl);
+            return e;
+        }
+
+        typename std::map<Edge, Node>::iterator te = _treeEdges.find(e);
+        if (te != _treeEdges.end())
+        {
+            _forest.setKey(te->second, lbl);        // a lighter tree edge stays
+            return e;
+        }
+
+        // a lighter non-tree edge may replace a tree one
+        --_nonTreeEdgesNum;
+        insertEdge(e, lbl);
+
+        return e;
+    }
+
+public:
+    // setters/getters
+    const Graph& getGraph() const { return _g; }
+
+    /// Returns the number of edges of the MST.
+    std::size_t getEdgesNum() const { return _treeEdges.size(); }
+
+    /// Returns the number of labeled edges that are not in the MST (except for
+    /// self-loops).
+    std::size_t getNonTreeEdgesNum() const { return _nonTreeEdgesNum; }
+
+    /// Determines whether the edge {s, d} is in the MST.
+    bool isTreeEdge(Vertex s, Vertex d) const
+    {
+        return _treeEdges.count(Graph::makeNormalizedEdge(s, d)) != 0;
+    }
+
+    /// Returns the normalized edges of the MST, as findMSTPrim() does.
+    std::set<Edge> getEdges() const
+    {
+        std::set<Edge> res;
+        for (const auto& te : _treeEdges)
+            res.insert(res.end(), te.first);
+
+        return res;
+    }
+
+    /// Returns the total weight of the MST; takes O(V) time.
+    EdgeLbl getWeight() const
+    {
+        EdgeLbl res = TWeightTraits::zero();
+        for (const auto& te : _treeEdges)
+            res = res + _forest.getKey(te.second);
+
+        return res;
+    }
+
+    /// Determines whether the vertices \a s and \a d are connected by labeled
+    /// edges.
+    bool isConnected(const Vertex& s, const Vertex& d)
+    {
+        typename std::map<Vertex, Node>::const_iterator si = _vertexNodes.find(s);
+        typename std::map<Vertex, Node>::const_iterator di = _vertexNodes.find(d);
+        if (si == _vertexNodes.end() || di == _vertexNodes.end())
+            return !(s < d) && !(d < s);
+
+        return _forest.isConnected(si->second, di->second);
+    }
+
+protected:
+    /// Returns the node of the vertex \a v making it if it is not there.
+    Node getNode(const Vertex& v)
+    {
+        typename std::map<Vertex, Node>::iterator it = _vertexNodes.lower_bound(v);
+        if (it == _vertexNodes.end() || v < it->first)
+            it = _vertexNodes.insert(it, std::make_pair(v, _forest.addNode()));
+
+        return it->second;
+    }
+
+    /// Puts the normalized edge \a e labeled \a lbl into the MST if it makes the
+    /// MST lighter.
+    void insertEdge(const Edge& e, const EdgeLbl& lbl)
+    {
+        if (e.first == e.second)
+            return;                                 // self-loops never get into a MST
+
+        const Node u = getNode(e.first);
+        const Node v = getNode(e.second);
+        const Node heaviest = _forest.findPathMax(u, v);
+        if (heaviest != Forest::NoNode)
+        {
+            // the new edge closes a cycle; the heaviest edge of it goes away
+            ++_nonTreeEdgesNum;
+            if (!_less(lbl, _forest.getKey(heaviest)))
+                return;
+            unlinkEdge(heaviest);
+        }
+
+        linkEdge(e, u, v, lbl);
+    }
+
+    /// Links the vertex nodes \a u and \a v of the edge \a e by a new node
+    /// labeled \a lbl.
+    void linkEdge(const Edge& e, Node u, Node v, const EdgeLbl& lbl)
+    {
+        Node en = _forest.addNode(lbl);
+        _forest.link(en, u);
+        _forest.link(en, v);
+
+        if (en >= _edgeOfNode.size())
+            _edgeOfNode.resize(en + 1);
+        _edgeOfNode[en] = e;
+        _treeEdges[e] = en;
+    }
+
+    /// Cuts the edge node \a en out of the forest and removes it.
+    void unlinkEdge(Node en)
+    {
+        const Edge e = _edgeOfNode[en];
+        _forest.cut(en, _vertexNodes[e.first]);
+        _forest.cut(en, _vertexNodes[e.second]);
+        _forest.removeNode(en);
+        _treeEdges.erase(e);
+    }
+
+protected:
+    Graph& _g;                              ///< Graph the MST is of.
+    Forest _forest;                         ///< MST as a link-cut tree.
+    std::map<Vertex, Node> _vertexNodes;    ///< Nodes of vertices.
+    std::map<Edge, Node> _treeEdges;        ///< Nodes of MST edges.
+    std::vector<Edge> _edgeOfNode;          ///< Edges of edge nodes.
+    std::size_t _nonTreeEdgesNum;           ///< Number of labeled edges not in the MST.
+    typename TWeightTraits::Compare _less;  ///< Ordering of weights.
+}; // class DynamicMST
+
+
+
+#endif // DYNAMIC_MST_HPP
@@ -0,0 +1,344 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a k-d tree of points and an algorithm finding Euclidean
+///             minimum spanning trees without building complete graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef EUCLIDEAN_MST_HPP
+#define EUCLIDEAN_MST_HPP
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+
+#include "ugraph_algos.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief The PointKdTree class represents a k-d tree over an array of points
+ *  answering nearest neighbour queries restricted by point colors.
+ *
+ *  Every node keeps the bounding box of its points and their common color if
+ *  they have one. A query skips the points of its own color, so whole subtrees
+ *  of that color are pruned without visiting them.
+ *
+ *  \tparam Coord represents a floating point type for coordinates.
+ *  \tparam Dim is the number of dimensions.
+ ******************************************************************************/
+template <typename Coord, std::size_t Dim>
+class PointKdTree {
+public:
+    // type definitions
+    typedef std::array<Coord, Dim> Point;
+
+    /// Denotes no point, no node or no common color.
+    static const std::size_t None = static_cast<std::size_t>(-1);
+
+    /// Max number of points in a leaf.
+    static const std::size_t LeafSize = 8;
+
+public:
+    /// Builds a tree over the \a points that must outlive it.
+    explicit PointKdTree(const std::vector<Point>& points)
+        : _points(points)
+        , _order(points.size())
+    {
+        for (std::size_t i = 0; i < _order.size(); ++i)
+            _order[i] = i;
+        if (!points.empty())
+            build(0, points.size());
+    }
+
+public:
+    // setters/getters
+
+    /// Returns the points in the order of leaves; close points are close in it.
+    const std::vector<std::size_t>& getOrder() const { return _order; }
+
+    /// Returns the squared distance between the points \a a and \a b.
+    Coord getDist2(std::size_t a, std::size_t b) const
+    {
+        Coord d2 = 0;
+        for (std::size_t k = 0; k < Dim; ++k)
+        {
+            const Coord t = _points[a][k] - _points[b][k];
+            d2 += t * t;
+        }
+
+        return d2;
+    }
+
+public:
+    /// Recalculates common colors of nodes by the \a colors of points.
+    void setColors(const std::vector<std::size_t>& colors)
+    {
+        for (std::size_t i = _nodes.size(); i > 0; --i)
+        {
+            Node& nd = _nodes[i - 1];
+            if (nd.left == None)
+            {
+                nd.color = colors[_order[nd.begin]];
+                for (std::size_t j = nd.begin + 1; j < nd.end && nd.color != None; ++j)
+                {
+                    if (colors[_order[j]] != nd.color)
+                        nd.color = None;
+                }
+            }
+            else
+            {
+                // children are made after their parents
+                const std::size_t c = _nodes[nd.left].color;
+                nd.color = (c == _nodes[nd.right].color) ? c : None;
+            }
+        }
+    }
+
+    /// \brief Finds the point nearest to the point \a q among the points with
+    /// colors other than \a color.
+    ///
+    /// A point is nearer if it has a smaller distance, or the same distance
+    /// and a smaller index. Only points nearer than {\a bestDist2, \a best}
+    /// are looked for; these are updated by the found one.
+    void findNearest(std::size_t q, std::size_t color, const std::vector<std::size_t>& colors,
+                     Coord& bestDist2, std::size_t& best)
+    {
+        _stack.clear();
+        _stack.push_back(0);
+        while (!_stack.empty())
+        {
+            const Node& nd = _nodes[_stack.back()];
+            _stack.pop_back();
+            if (nd.color == color || getBoxDist2(q, nd) > bestDist2)
+                continue;
+
+            if (nd.left == None)
+            {
+                for (std::size_t j = nd.begin; j < nd.end; ++j)
+                {
+                    const std::size_t p = _order[j];
+                    if (colors[p] == color)
+                        continue;
+
+                    const Coord d2 = getDist2(q, p);
+                    if (d2 < bestDist2 || (d2 == bestDist2 && p < best))
+                    {
+                        bestDist2 = d2;
+                        best = p;
+                    }
+                }
+                continue;
+            }
+
+            // the nearer child is visited first, so it is pushed last
+            const bool leftFirst = _points[q][nd.splitDim] < nd.split;
+            _stack.push_back(leftFirst ? nd.right : nd.left);
+            _stack.push_back(leftFirst ? nd.left : nd.right);
+        }
+    }
+
+protected:
+    /// Node of the tree.
+    struct Node {
+        Point lo;                   ///< Lower corner of the bounding box.
+        Point hi;                   ///< Upper corner of the bounding box.
+        std::size_t begin;          ///< First point in the order.
+        std::size_t end;            ///< After the last point in the order.
+        std::size_t left;           ///< Left child or None for a leaf.
+        std::size_t right;          ///< Right child.
+        std::size_t splitDim;       ///< Dimension the node is split by.
+        Coord split;                ///< Median coordinate.
+        std::size_t color;          ///< Common color of points or None.
+    };
+
+protected:
+    /// Makes a node of the points [\a begin, \a end) of the order and its
+    /// subtree; returns the node.
+    std::size_t build(std::size_t begin, std::size_t end)
+    {
+        const std::size_t id = _nodes.size();
+        _nodes.push_back(Node());
+        Node nd;
+        nd.begin = begin;
+        nd.end = end;
+        nd.left = nd.right = None;
+        nd.splitDim = 0;
+        nd.split = 0;
+        nd.color = None;
+        nd.lo = nd.hi = _points[_order[begin]];
+        for (std::size_t j = begin + 1; j < end; ++j)
+        {
+            const Point& p = _points[_order[j]];
+            for (std::size_t k = 0; k < Dim; ++k)
+            {
+                nd.lo[k] = std::min(nd.lo[k], p[k]);
+                nd.hi[k] = std::max(nd.hi[k], p[k]);
+            }
+        }
+
+        if (end - begin > LeafSize)
+        {
+            for (std::size_t k = 1; k < Dim; ++k)
+            {
+                if (nd.hi[k] - nd.lo[k] > nd.hi[nd.splitDim] - nd.lo[nd.splitDim])
+                    nd.splitDim = k;
+            }
+
+            const std::size_t k = nd.splitDim;
+            const std::size_t mid = begin + (end - begin) / 2;
+            std::nth_element(_order.begin() + begin, _order.begin() + mid,
+                             _order.begin() + end, [this, k](std::size_t a, std::size_t b)
+                             {
+                                 return _points[a][k] < _points[b][k];
+                             });
+            nd.split = _points[_order[mid]][k];
+            nd.left = build(begin, mid);
+            nd.right = build(mid, end);
+        }
+        _nodes[id] = nd;
+
+        return id;
+    }
+
+    /// Returns the squared distance from the point \a q to the box of \a nd.
+    Coord getBoxDist2(std::size_t q, const Node& nd) const
+    {
+        Coord d2 = 0;
+        for (std::size_t k = 0; k < Dim; ++k)
+        {
+            const Coord x = _points[q][k];
+            const Coord t = x < nd.lo[k] ? nd.lo[k] - x : (x > nd.hi[k] ? x - nd.hi[k] : 0);
+            d2 += t * t;
+        }
+
+        return d2;
+    }
+
+protected:
+    const std::vector<Point>& _points;      ///< Points.
+    std::vector<std::size_t> _order;        ///< Points in the order of leaves.
+    std::vector<Node> _nodes;               ///< Nodes; the root is the first.
+    std::vector<std::size_t> _stack;        ///< Buffer of findNearest().
+}; // class PointKdTree
+
+template <typename Coord, std::size_t Dim>
+const std::size_t PointKdTree<Coord, Dim>::None;
+
+template <typename Coord, std::size_t Dim>
+const std::size_t PointKdTree<Coord, Dim>::LeafSize;
+
+
+/// \brief Finds a minimum spanning tree of the complete graph of the \a points
+/// where edges are labeled by Euclidean distances; vertices are indices of
+/// points, labels are distances.
+///
+/// Borůvka's algorithm runs over a k-d tree: every round every point looks
+/// for the nearest point of another component, pruning subtrees of its own
+/// component and subtrees farther than the best edge of the component found so
+/// far. It takes about O(n log n) time and O(n) memory instead of O(n^2) for
+/// the complete graph. Edges with equal lengths are ordered by their ends, so
+/// the result is the same as the one of findMSTKruskal() for the complete
+/// graph.
+///
+/// \throws std::invalid_argument if a coordinate is not finite.
+template <typename Coord, std::size_t Dim>
+MSTEdges<std::size_t, Coord> findEuclideanMST(const std::vector<std::array<Coord, Dim> >& points)
+{
+    static_assert(std::is_floating_point<Coord>::value, "Coordinates must be floating point");
+    static_assert(Dim > 0, "Points must have coordinates");
+
+    typedef PointKdTree<Coord, Dim> Tree;
+    const std::size_t n = points.size();
+    for (const std::array<Coord, Dim>& p : points)
+    {
+        for (Coord x : p)
+        {
+            if (!std::isfinite(x))
+                throw std::invalid_argument("Coordinates must be finite");
+        }
+    }
+
+    MSTEdges<std::size_t, Coord> res;
+    res.weight = 0;
+    if (n < 2)
+        return res;
+    res.edges.reserve(n - 1);
+
+    Tree tree(points);
+    DisjointSet components(n);
+    std::vector<std::size_t> colors(n);
+    std::vector<Coord> bestDist2(n);                // by components
+    std::vector<std::size_t> bestFrom(n), bestTo(n);
+
+    while (components.getSetsNum() > 1)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            colors[i] = components.find(i);
+            bestTo[i] = Tree::None;
+        }
+        tree.setColors(colors);
+
+        for (std::size_t i : tree.getOrder())
+        {
+            // the best edge of the component bounds the search, and the order
+            // of edges with equal lengths is kept by comparing their ends
+            const std::size_t c = colors[i];
+            Coord d2 = bestTo[c] == Tree::None ? std::numeric_limits<Coord>::infinity()
+                                               : bestDist2[c];
+            std::size_t to = Tree::None;
+            tree.findNearest(i, c, colors, d2, to);
+            if (to == Tree::None)
+                continue;
+
+            const std::size_t s = std::min(i, to), d = std::max(i, to);
+            if (bestTo[c] != Tree::None && d2 == bestDist2[c])
+            {
+                const std::size_t bs = std::min(bestFrom[c], bestTo[c]);
+                const std::size_t bd = std::max(bestFrom[c], bestTo[c]);
+                if (bs < s || (bs == s && bd <= d))
+                    continue;
+            }
+            bestDist2[c] = d2;
+            bestFrom[c] = i;
+            bestTo[c] = to;
+        }
+
+        for (std::size_t c = 0; c < n; ++c)
+        {
+            if (colors[c] != c || bestTo[c] == Tree::None)
+                continue;
+
+            const std::size_t s = std::min(bestFrom[c], bestTo[c]);
+            const std::size_t d = std::max(bestFrom[c], bestTo[c]);
+            if (components.unite(s, d))
+            {
+                const Coord len = std::sqrt(bestDist2[c]);
+                LblEdge<std::size_t, Coord> e = {s, d, len};
+                res.edges.push_back(e);
+                res.weight += len;
+            }
+        }
+    }
+
+    return res;
+}
+
+
+
+#endif // EUCLIDEAN_MST_HPP
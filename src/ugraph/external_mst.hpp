@@ -0,0 +1,580 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains an out-of-core MST algorithm for edge sets that do not
+///             fit into memory.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+/// A work directory keeps:
+///   - run files "run-<id>.bin": arrays of LblEdge in the order of Kruskal's
+///     algorithm, written as they are in memory;
+///   - a text file "manifest" listing the finished runs and the number of
+///     input edges they cover; its first line has the sizes and kinds (see
+///     getTypeTag()) of vertices and labels the runs are written for.
+/// Files are written under temporary names and renamed, so a crashed process
+/// leaves the work directory in the state of the last finished run.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef EXTERNAL_MST_HPP
+#define EXTERNAL_MST_HPP
+
+#include <map>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+
+#include "disjoint_set.hpp"
+#include "csr_snapshot.hpp"
+#include "streaming_mst.hpp"
+
+
+
+/*! ****************************************************************************
+ *  \brief The ExternalMST class finds a minimum spanning forest of a graph
+ *  whose edges do not fit into memory using sorted runs on disk.
+ *
+ *  Edges are taken in chunks of at most runEdgesNum ones. Every chunk is
+ *  sorted and reduced to its own minimum spanning forest before it is written
+ *  as a run: an edge that is the heaviest on a cycle of a chunk is the heaviest
+ *  on a cycle of the graph, so it is never in the MST. A run thus has less
+ *  edges than vertices. Runs are merged with Kruskal's algorithm filtering the
+ *  merged stream in the same way, at most fanIn runs at a time, until a single
+ *  merge gives the MST. All the I/O is sequential.
+ *
+ *  Memory is O(runEdgesNum) for chunks and merge buffers plus O(V) for the
+ *  disjoint sets of a merge.
+ *
+ *  Every finished run is recorded in the manifest. An object created on a
+ *  work directory with a manifest resumes: the caller feeds the same input
+ *  from the beginning, and the edges covered by the runs are skipped.
+ *
+ *  Edges with equal labels are ordered by their vertices, so the result is the
+ *  same as the one of findMSTKruskal(). Self-loops are skipped.
+ *
+ *  \tparam Vertex represents a type for vertices; must be trivially copyable.
+ *  \tparam EdgeLbl represents a type for edge labels; must be trivially
+ *  copyable.
+ *  \tparam TWeightTraits describes labels as weights (see WeightTraits).
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+class ExternalMST {
+public:
+    // type definitions
+
+    /// Record of a run file.
+    typedef LblEdge<Vertex, EdgeLbl> Edge;
+
+    static_assert(std::is_trivially_copyable<Vertex>::value,
+                  "Vertex must be trivially copyable to be stored in a run file");
+    static_assert(std::is_trivially_copyable<EdgeLbl>::value,
+                  "EdgeLbl must be trivially copyable to be stored in a run file");
+
+public:
+    /// \brief Creates an engine keeping its files in the existing directory
+    /// \a workDir and taking chunks of \a runEdgesNum edges; at most \a fanIn
+    /// runs are merged at a time.
+    ///
+    /// If the directory has a manifest, the state is restored from it.
+    ///
+    /// \throws std::invalid_argument if \a runEdgesNum is 0, \a fanIn is less
+    /// than 2, or the manifest is malformed or written for other types.
+    ExternalMST(const std::string& workDir, std::size_t runEdgesNum,
+                std::size_t fanIn = 64)
+        : _dir(workDir)
+        , _runEdgesNum(runEdgesNum)
+        , _fanIn(fanIn)
+        , _consumedNum(0)
+        , _pendingNum(0)
+        , _skipNum(0)
+        , _nextRunId(0)
+    {
+        if (runEdgesNum == 0)
+            throw std::invalid_argument("Runs must have edges");
+        if (fanIn < 2)
+            throw std::invalid_argument("At least two runs must be merged at a time");
+
+        loadManifest();
+        _skipNum = _consumedNum;
+    }
+
+public:
+    // Input consuming methods.
+
+    /// Takes the next edge {s, d} labeled \a lbl of the input.
+    void addEdge(const Vertex& s, const Vertex& d, const EdgeLbl& lbl)
+    {
+        if (_skipNum)
+        {
+            --_skipNum;                             // it is in a run already
+            return;
+        }
+
+        ++_pendingNum;
+        if (s < d)
+        {
+            Edge e = {s, d, lbl};
+            _chunk.push_back(e);
+        }
+        else if (d < s)
+        {
+            Edge e = {d, s, lbl};
+            _chunk.push_back(e);
+        }
+
+        if (_chunk.size() >= _runEdgesNum)
+            flushRun();
+    }
+
+    /// Takes all the edges from the text stream \a in of triples "s d label".
+    ///
+    /// \throws std::invalid_argument if the stream is malformed.
+    void readEdges(std::istream& in)
+    {
+        readEdgeTriples<Vertex, EdgeLbl>(in, [this](const Vertex& s, const Vertex& d,
+                                                     const EdgeLbl& lbl)
+        {
+            addEdge(s, d, lbl);
+        });
+    }
+
+    /// Takes all the labeled edges of the snapshot \a g (usually mapped by
+    /// mapCsrSnapshot()) in the order of their smaller vertices.
+    void readEdges(const CsrSnapshot<Vertex, EdgeLbl>& g)
+    {
+        typedef CsrSnapshot<Vertex, EdgeLbl> Graph;
+
+        const VertexId n = static_cast<VertexId>(g.getVerticesNum());
+        for (VertexId v = 0; v < n; ++v)
+        {
+            typename Graph::AdjCIterPair range = g.getAdjEdges(v);
+            for (typename Graph::AdjCIter it = range.first; it != range.second; ++it)
+            {
+                if (it->vertex <= v || !it->hasLbl)
+                    continue;                       // every edge is taken once
+                addEdge(g.getVertex(v), g.getVertex(it->vertex), it->lbl);
+            }
+        }
+    }
+
+    /// \brief Writes the last run and merges all the runs; returns the edges
+    /// of the MST in the order of Kruskal's algorithm with their total weight.
+    ///
+    /// Intermediate merges are recorded in the manifest as well; the files
+    /// are kept until removeFiles() is called.
+    ///
+    /// \throws std::runtime_error if a file can't be written or read.
+    MSTEdges<Vertex, EdgeLbl> finish()
+    {
+        flushRun();
+        while (_runs.size() > _fanIn)
+            mergeFirstRuns();
+
+        MSTEdges<Vertex, EdgeLbl> res;
+        res.weight = TWeightTraits::zero();
+        mergeRuns(_runs.size(), [&res](const Edge& e)
+        {
+            res.edges.push_back(e);
+            res.weight = res.weight + e.lbl;
+        });
+
+        return res;
+    }
+
+    /// Removes the run files and the manifest from the work directory and
+    /// starts anew.
+    void removeFiles()
+    {
+        for (const RunInfo& r : _runs)
+            std::remove(getRunFileName(r.id).c_str());
+        std::remove(getManifestFileName().c_str());
+
+        _runs.clear();
+        _chunk.clear();
+        _consumedNum = _pendingNum = _skipNum = 0;
+        _nextRunId = 0;
+    }
+
+public:
+    // setters/getters
+
+    /// Returns the number of input edges covered by the runs.
+    std::uint64_t getConsumedNum() const { return _consumedNum; }
+
+    /// Returns the number of input edges to be skipped yet after resuming.
+    std::uint64_t getSkipNum() const { return _skipNum; }
+
+    /// Returns the number of runs on disk.
+    std::size_t getRunsNum() const { return _runs.size(); }
+
+    /// Returns the total number of edges in the runs on disk.
+    std::uint64_t getRunEdgesNum() const
+    {
+        std::uint64_t n = 0;
+        for (const RunInfo& r : _runs)
+            n += r.size;
+
+        return n;
+    }
+
+protected:
+    /// Finished run.
+    struct RunInfo {
+        std::uint64_t id;                   ///< Number in the file name.
+        std::uint64_t size;                 ///< Number of edges.
+    };
+
+    /// Reader of a run file with a buffer.
+    struct RunReader {
+        std::ifstream file;                 ///< Run file.
+        std::vector<Edge> buf;              ///< Edges read ahead.
+        std::size_t pos;                    ///< Next edge in buf.
+        std::size_t bufSize;                ///< Maximum size of buf.
+        std::uint64_t left;                 ///< Edges in the file not read yet.
+    };
+
+protected:
+    /// Determines whether the edge \a a goes before the edge \a b in Kruskal's
+    /// algorithm.
+    bool isBefore(const Edge& a, const Edge& b) const
+    {
+        if (_less(a.lbl, b.lbl))
+            return true;
+        if (_less(b.lbl, a.lbl))
+            return false;
+        if (a.s < b.s)
+            return true;
+        if (b.s < a.s)
+            return false;
+
+        return a.d < b.d;
+    }
+
+    std::string getRunFileName(std::uint64_t id) const
+    {
+        return _dir + "/run-" + std::to_string(id) + ".bin";
+    }
+
+    std::string getManifestFileName() const
+    {
+        return _dir + "/manifest";
+    }
+
+    /// Returns the kind of the type \a T for the manifest: 'f' for floating
+    /// point types, 's' and 'u' for signed and unsigned integers, 'x' for
+    /// others; along with sizes it tells run files of other types apart.
+    template <typename T>
+    static char getTypeTag()
+    {
+        return std::is_floating_point<T>::value ? 'f'
+               : !std::is_integral<T>::value ? 'x'
+               : std::is_signed<T>::value ? 's' : 'u';
+    }
+
+    /// Renames the file \a from to \a to replacing it.
+    static void replaceFile(const std::string& from, const std::string& to)
+    {
+        if (std::rename(from.c_str(), to.c_str()) != 0)
+            throw std::runtime_error("Can't rename a file in a work directory");
+    }
+
+    /// Reduces the current chunk to its minimum spanning forest and writes it
+    /// as a new run.
+    void flushRun()
+    {
+        if (_pendingNum == 0)
+            return;
+
+        std::sort(_chunk.begin(), _chunk.end(), [this](const Edge& a, const Edge& b)
+            {
+                return isBefore(a, b);
+            });
+
+        // vertices of the chunk are numbered by their order
+        _chunkVertices.clear();
+        for (const Edge& e : _chunk)
+        {
+            _chunkVertices.push_back(e.s);
+            _chunkVertices.push_back(e.d);
+        }
+        std::sort(_chunkVertices.begin(), _chunkVertices.end());
+        _chunkVertices.erase(std::unique(_chunkVertices.begin(), _chunkVertices.end(),
+                                         [](const Vertex& a, const Vertex& b)
+                                         {
+                                             return !(a < b) && !(b < a);
+                                         }),
+                             _chunkVertices.end());
+
+        auto idOf = [this](const Vertex& v)
+        {
+            return static_cast<DisjointSet::Elem>(
+                std::lower_bound(_chunkVertices.begin(), _chunkVertices.end(), v)
+                - _chunkVertices.begin());
+        };
+
+        _trees.reset(_chunkVertices.size());
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < _chunk.size() && _trees.getSetsNum() > 1; ++i)
+        {
+            if (_trees.unite(idOf(_chunk[i].s), idOf(_chunk[i].d)))
+                _chunk[kept++] = _chunk[i];
+        }
+        _chunk.resize(kept);
+
+        const std::uint64_t id = _nextRunId++;
+        writeRun(id, _chunk.data(), _chunk.size());
+        RunInfo r = {id, _chunk.size()};
+        _runs.push_back(r);
+        _consumedNum += _pendingNum;
+        _pendingNum = 0;
+        _chunk.clear();
+        writeManifest();
+    }
+
+    /// Writes the \a n edges \a data to the run file with the number \a id.
+    void writeRun(std::uint64_t id, const Edge* data, std::size_t n)
+    {
+        const std::string fn = getRunFileName(id);
+        {
+            std::ofstream f((fn + ".tmp").c_str(), std::ios::binary | std::ios::trunc);
+            if (!f.is_open())
+                throw std::runtime_error("Can't open a run file for writing");
+            f.write(reinterpret_cast<const char*>(data),
+                    static_cast<std::streamsize>(n * sizeof(Edge)));
+            f.flush();
+            if (!f)
+                throw std::runtime_error("Can't write a run file");
+        }
+        replaceFile(fn + ".tmp", fn);
+    }
+
+    /// Merges the first \a runsNum runs calling f(e) for every edge e of their
+    /// minimum spanning forest in the order of Kruskal's algorithm.
+    template <typename TEdgeFunc>
+    void mergeRuns(std::size_t runsNum, TEdgeFunc f)
+    {
+        // buffers share the memory of a chunk
+        const std::size_t bufSize = std::max<std::size_t>(1, _runEdgesNum
+                                                             / std::max<std::size_t>(1, runsNum));
+        std::vector<RunReader> readers(runsNum);
+        std::vector<std::size_t> heap;
+        for (std::size_t i = 0; i < runsNum; ++i)
+        {
+            RunReader& r = readers[i];
+            r.file.open(getRunFileName(_runs[i].id).c_str(), std::ios::binary);
+            if (!r.file.is_open())
+                throw std::runtime_error("Can't open a run file");
+            r.bufSize = bufSize;
+            r.left = _runs[i].size;
+            if (fillBuffer(r))
+                heap.push_back(i);
+        }
+
+        // the heap keeps readers with the lightest head edges on top
+        auto after = [this, &readers](std::size_t a, std::size_t b)
+        {
+            return isBefore(readers[b].buf[readers[b].pos], readers[a].buf[readers[a].pos]);
+        };
+        std::make_heap(heap.begin(), heap.end(), after);
+
+        DisjointSet trees;
+        std::map<Vertex, DisjointSet::Elem> ids;
+        auto idOf = [&trees, &ids](const Vertex& v)
+        {
+            typename std::map<Vertex, DisjointSet::Elem>::iterator it = ids.lower_bound(v);
+            if (it == ids.end() || v < it->first)
+                it = ids.insert(it, std::make_pair(v, trees.addElem()));
+
+            return it->second;
+        };
+
+        while (!heap.empty())
+        {
+            std::pop_heap(heap.begin(), heap.end(), after);
+            RunReader& r = readers[heap.back()];
+            const Edge e = r.buf[r.pos++];
+            if (r.pos < r.buf.size() || fillBuffer(r))
+                std::push_heap(heap.begin(), heap.end(), after);
+            else
+                heap.pop_back();
+
+            if (trees.unite(idOf(e.s), idOf(e.d)))
+                f(e);
+        }
+    }
+
+    /// Reads the next edges of the run of \a r into its buffer; returns false
+    /// if the run is over.
+    bool fillBuffer(RunReader& r)
+    {
+        const std::size_t n = static_cast<std::size_t>(
+            std::min<std::uint64_t>(r.left, r.bufSize));
+        if (n == 0)
+            return false;
+
+        r.buf.resize(n);
+        r.file.read(reinterpret_cast<char*>(r.buf.data()),
+                    static_cast<std::streamsize>(n * sizeof(Edge)));
+        if (!r.file)
+            throw std::runtime_error("Can't read a run file");
+        r.left -= n;
+        r.pos = 0;
+
+        return true;
+    }
+
+    /// Replaces the first fanIn runs with the run of their minimum spanning
+    /// forest.
+    void mergeFirstRuns()
+    {
+        std::vector<Edge> merged;
+        mergeRuns(_fanIn, [&merged](const Edge& e) { merged.push_back(e); });
+
+        const std::uint64_t id = _nextRunId++;
+        writeRun(id, merged.data(), merged.size());
+        std::vector<RunInfo> old(_runs.begin(), _runs.begin() + _fanIn);
+        _runs.erase(_runs.begin(), _runs.begin() + _fanIn);
+        RunInfo r = {id, merged.size()};
+        _runs.push_back(r);
+        writeManifest();
+
+        for (const RunInfo& o : old)
+            std::remove(getRunFileName(o.id).c_str());
+    }
+
+    /// Writes the manifest with the current state.
+    void writeManifest()
+    {
+        const std::string fn = getManifestFileName();
+        {
+            std::ofstream f((fn + ".tmp").c_str(), std::ios::trunc);
+            if (!f.is_open())
+                throw std::runtime_error("Can't open a manifest for writing");
+
+            f << "UGREXTMST 2 " << sizeof(Vertex) << ' ' << getTypeTag<Vertex>() << ' '
+              << sizeof(EdgeLbl) << ' ' << getTypeTag<EdgeLbl>() << '\n'
+              << "consumed " << _consumedNum << '\n'
+              << "next " << _nextRunId << '\n';
+            for (const RunInfo& r : _runs)
+                f << "run " << r.id << ' ' << r.size << '\n';
+            f.flush();
+            if (!f)
+                throw std::runtime_error("Can't write a manifest");
+        }
+        replaceFile(fn + ".tmp", fn);
+    }
+
+    /// Restores the state from the manifest if there is one.
+    void loadManifest()
+    {
+        std::ifstream f(getManifestFileName().c_str());
+        if (!f.is_open())
+            return;
+
+        std::string magic, key;
+        int version = 0;
+        std::size_t vertexSize = 0, lblSize = 0;
+        char vertexTag = 0, lblTag = 0;
+        if (!(f >> magic >> version) || magic != "UGREXTMST" || version != 2
+            || !(f >> vertexSize >> vertexTag >> lblSize >> lblTag))
+            throw std::invalid_argument("Malformed manifest");
+        if (vertexSize != sizeof(Vertex) || vertexTag != getTypeTag<Vertex>()
+            || lblSize != sizeof(EdgeLbl) || lblTag != getTypeTag<EdgeLbl>())
+            throw std::invalid_argument("Manifest was written for other types");
+
+        if (!(f >> key >> _consumedNum) || key != "consumed"
+            || !(f >> key >> _nextRunId) || key != "next")
+            throw std::invalid_argument("Malformed manifest");
+
+        RunInfo r;
+        while (f >> key)
+        {
+            if (key != "run" || !(f >> r.id >> r.size))
+                throw std::invalid_argument("Malformed manifest");
+            _runs.push_back(r);
+        }
+    }
+
+protected:
+    std::string _dir;                       ///< Work directory.
+    std::size_t _runEdgesNum;               ///< Maximum size of a chunk.
+    std::size_t _fanIn;                     ///< Maximum runs merged at a time.
+    std::uint64_t _consumedNum;             ///< Input edges covered by runs.
+    std::uint64_t _pendingNum;              ///< Input edges of the chunk.
+    std::uint64_t _skipNum;                 ///< Input edges to skip on resuming.
+    std::uint64_t _nextRunId;               ///< Number of the next run file.
+    std::vector<RunInfo> _runs;             ///< Finished runs.
+    std::vector<Edge> _chunk;               ///< Edges of the current chunk.
+    std::vector<Vertex> _chunkVertices;     ///< Buffer of flushRun().
+    DisjointSet _trees;                     ///< Buffer of flushRun().
+    typename TWeightTraits::Compare _less;  ///< Ordering of weights.
+}; // class ExternalMST
+
+
+/// \brief Finds a MST of the graph given by the text stream \a in of triples
+/// "s d label" out of core, keeping files in \a workDir and taking chunks of
+/// \a runEdgesNum edges (see ExternalMST).
+///
+/// A work directory left by a failed call is resumed from it; the files are
+/// removed after success.
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+MSTEdges<Vertex, EdgeLbl> findMSTExternal(std::istream& in, const std::string& workDir,
+                                          std::size_t runEdgesNum)
+{
+    ExternalMST<Vertex, EdgeLbl, TWeightTraits> mst(workDir, runEdgesNum);
+    mst.readEdges(in);
+    MSTEdges<Vertex, EdgeLbl> res = mst.finish();
+    mst.removeFiles();
+
+    return res;
+}
+
+/// Finds a MST of the graph given by the text file with the name \a fn of
+/// triples "s d label" out of core.
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+MSTEdges<Vertex, EdgeLbl> findMSTExternal(const std::string& fn, const std::string& workDir,
+                                          std::size_t runEdgesNum)
+{
+    std::ifstream f(fn.c_str());
+    if (!f.is_open())
+        throw std::invalid_argument("Can't open an edge stream file");
+
+    return findMSTExternal<Vertex, EdgeLbl, TWeightTraits>(f, workDir, runEdgesNum);
+}
+
+/// Finds a MST of the snapshot \a g (usually mapped from a CSR file by
+/// mapCsrSnapshot()) out of core.
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+MSTEdges<Vertex, EdgeLbl> findMSTExternal(const CsrSnapshot<Vertex, EdgeLbl>& g,
+                                          const std::string& workDir,
+                                          std::size_t runEdgesNum)
+{
+    ExternalMST<Vertex, EdgeLbl, TWeightTraits> mst(workDir, runEdgesNum);
+    mst.readEdges(g);
+    MSTEdges<Vertex, EdgeLbl> res = mst.finish();
+    mst.removeFiles();
+
+    return res;
+}
+
+
+
+#endif // EXTERNAL_MST_HPP
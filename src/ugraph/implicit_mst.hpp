@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains Prim's algorithm for complete graphs whose labels are
+///             given by a weight function instead of stored edges.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IMPLICIT_MST_HPP
+#define IMPLICIT_MST_HPP
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+
+#include "ugraph_algos.hpp"
+
+
+
+/// Determines whether the weight function \a F can evaluate labels of a block
+/// of edges at once, i.e. has f(u, vs, k, out) putting labels of the edges
+/// {u, vs[0]}, ..., {u, vs[k - 1]} to out[0..k-1].
+template <typename F, typename EdgeLbl, typename = void>
+struct HasBlockWeights : std::false_type {};
+
+template <typename F, typename EdgeLbl>
+struct HasBlockWeights<F, EdgeLbl,
+                       decltype(std::declval<const F&>()(VertexId(),
+                                                         static_cast<const VertexId*>(nullptr),
+                                                         std::size_t(),
+                                                         static_cast<EdgeLbl*>(nullptr)),
+                                void())> : std::true_type {};
+
+
+/// Puts labels of the edges {u, vs[i]} given by the block weight function \a f
+/// to \a out.
+template <typename EdgeLbl, typename TWeightFunc>
+void evalBlockWeights(const TWeightFunc& f, VertexId u, const VertexId* vs, std::size_t k,
+                      EdgeLbl* out, std::true_type)
+{
+    f(u, vs, k, out);
+}
+
+/// Puts labels of the edges {u, vs[i]} given by the weight function \a f of
+/// single edges to \a out.
+template <typename EdgeLbl, typename TWeightFunc>
+void evalBlockWeights(const TWeightFunc& f, VertexId u, const VertexId* vs, std::size_t k,
+                      EdgeLbl* out, std::false_type)
+{
+    for (std::size_t i = 0; i < k; ++i)
+        out[i] = f(u, vs[i]);
+}
+
+
+/// \brief Finds a MST of the complete graph with \a n vertices 0..n-1 whose
+/// edge {u, v} is labeled by weight(u, v); edges labeled by infinity (see
+/// WeightTraits) are absent, so the result may be a forest.
+///
+/// Prim's algorithm keeps keys of the vertices not in the tree yet in a
+/// compact array, so every step evaluates the labels of the edges from the
+/// last added vertex in blocks, relaxes the keys with a branchless loop and
+/// takes the next vertex by findArgMin() (AVX2 for int and float labels if
+/// available). Every label is evaluated once: it takes O(V^2) time and O(V)
+/// memory.
+///
+/// The weight function is either weight(u, v) returning a label or, to
+/// vectorize the evaluation itself, weight(u, vs, k, out) evaluating a block of
+/// k edges (see HasBlockWeights). It must be symmetric.
+///
+/// If \a pool is not null, every step is split into chunks of at least
+/// \a minGrain vertices scanned in parallel, so the weight function must be
+/// safe to call concurrently. The result does not depend on the pool.
+///
+/// \return edges {s, d}, s < d, in the order they are added, with the total
+/// weight.
+/// \throws std::length_error if \a n does not fit VertexId.
+template <typename EdgeLbl, typename TWeightTraits = WeightTraits<EdgeLbl>,
+          typename TWeightFunc>
+MSTEdges<VertexId, EdgeLbl> findMSTImplicit(std::size_t n, TWeightFunc weight,
+                                            WorkStealingPool* pool = nullptr,
+                                            std::size_t minGrain = 4096)
+{
+    typedef typename TWeightTraits::Compare Compare;
+    typedef HasBlockWeights<TWeightFunc, EdgeLbl> IsBlock;
+    const std::size_t BlockSize = 256;
+
+    if (n > static_cast<std::size_t>(static_cast<VertexId>(-1)))
+        throw std::length_error("Too many vertices for an implicit graph");
+
+    MSTEdges<VertexId, EdgeLbl> res;
+    res.weight = TWeightTraits::zero();
+    if (n == 0)
+        return res;
+    res.edges.reserve(n - 1);
+
+    const EdgeLbl inf = TWeightTraits::infinity();
+    const Compare less = Compare();
+
+    // vertices out of the tree with their keys and parents; the added vertex
+    // is replaced by the last one
+    std::vector<VertexId> rest(n - 1);
+    std::vector<EdgeLbl> keys(n - 1, inf);
+    std::vector<VertexId> parents(n - 1);
+    for (std::size_t i = 0; i + 1 < n; ++i)
+        rest[i] = static_cast<VertexId>(i + 1);
+
+    // relaxes keys of [from, to) by the edges from u; returns the best position
+    auto scan = [&](VertexId u, std::size_t from, std::size_t to)
+    {
+        EdgeLbl w[BlockSize];
+        for (std::size_t b = from; b < to; b += BlockSize)
+        {
+            const std::size_t k = std::min(BlockSize, to - b);
+            evalBlockWeights<EdgeLbl>(weight, u, rest.data() + b, k, w, IsBlock());
+
+            EdgeLbl* kb = keys.data() + b;
+            VertexId* pb = parents.data() + b;
+            for (std::size_t i = 0; i < k; ++i)
+            {
+                const bool lighter = less(w[i], kb[i]);
+                kb[i] = lighter ? w[i] : kb[i];
+                pb[i] = lighter ? u : pb[i];
+            }
+        }
+
+        return from + findArgMin(keys.data() + from, to - from, less);
+    };
+
+    std::vector<std::size_t> chunkBest;
+    VertexId u = 0;
+    for (std::size_t m = n - 1; m > 0; --m)
+    {
+        std::size_t j;
+        if (pool && m > minGrain)
+        {
+            const std::size_t grain = pool->suggestGrain(m, minGrain);
+            chunkBest.resize((m + grain - 1) / grain);
+            pool->parallelFor(0, m, grain, [&](std::size_t from, std::size_t to)
+            {
+                chunkBest[from / grain] = scan(u, from, to);
+            });
+
+            // chunks are ordered, so the first of equal keys wins as in scan()
+            j = chunkBest[0];
+            for (std::size_t c = 1; c < chunkBest.size(); ++c)
+            {
+                if (less(keys[chunkBest[c]], keys[j]))
+                    j = chunkBest[c];
+            }
+        }
+        else
+            j = scan(u, 0, m);
+
+        u = rest[j];
+        if (less(keys[j], inf))
+        {
+            const VertexId p = parents[j];
+            LblEdge<VertexId, EdgeLbl> e = {std::min(p, u), std::max(p, u), keys[j]};
+            res.edges.push_back(e);
+            res.weight = res.weight + keys[j];
+        }
+        // otherwise u is not reached and starts the next tree
+
+        rest[j] = rest[m - 1];
+        keys[j] = keys[m - 1];
+        parents[j] = parents[m - 1];
+    }
+
+    return res;
+}
+
+
+
+#endif // IMPLICIT_MST_HPP
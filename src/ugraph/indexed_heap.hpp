@@ -0,0 +1,263 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains an indexed d-ary heap used as a priority queue by the
+///             graph algorithms.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef INDEXED_HEAP_HPP
+#define INDEXED_HEAP_HPP
+
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <cstddef>
+
+
+
+/*! ****************************************************************************
+ *  \brief The IndexedDaryHeap class represents a min-priority queue of handles
+ *  with associated keys that supports decreasing a key in place.
+ *
+ *  Handles are integers from the range [0, capacity). The heap itself and the
+ *  positions of every handle in it are stored in flat arrays that are allocated
+ *  once by the constructor (or by reset()), so no operation except reset()
+ *  allocates memory.
+ *
+ *  \tparam Key represents a type for keys (priorities).
+ *  \tparam Arity is the number of children of every heap node. Must be >= 2.
+ *  \tparam Compare is a strict weak ordering for keys; the “smallest” key
+ *  goes on top.
+ ******************************************************************************/
+template <typename Key, unsigned Arity = 4, typename Compare = std::less<Key> >
+class IndexedDaryHeap {
+    static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+public:
+    // type definitions
+
+    /// Handle of an element of the queue.
+    typedef std::size_t Handle;
+
+    /// Denotes a handle that is not in the queue.
+    static const std::size_t NPos = static_cast<std::size_t>(-1);
+
+public:
+    /// Creates a heap that is able to store handles from [0, \a capacity).
+    explicit IndexedDaryHeap(std::size_t capacity = 0,
+                             const Compare& cmp = Compare())
+        : _size(0)
+        , _cmp(cmp)
+    {
+        reset(capacity);
+    }
+
+    /// Empties the heap and makes it able to store handles from
+    /// [0, \a capacity). Reallocates memory only if the capacity grows.
+    void reset(std::size_t capacity)
+    {
+        clear();
+        _heap.resize(capacity);
+        _pos.resize(capacity, NPos);
+    }
+
+    /// Removes all the elements; takes O(size) time and does not free memory.
+    void clear()
+    {
+        for (std::size_t i = 0; i < _size; ++i)
+            _pos[_heap[i].handle] = NPos;
+        _size = 0;
+    }
+
+public:
+    // setters/getters
+    bool isEmpty() const { return _size == 0; }
+    std::size_t getSize() const { return _size; }
+    std::size_t getCapacity() const { return _pos.size(); }
+
+    /// Determines whether the handle \a h is in the queue.
+    bool contains(Handle h) const
+    {
+        return h < _pos.size() && _pos[h] != NPos;
+    }
+
+    /// Returns the key associated with the handle \a h that must be in the
+    /// queue.
+    const Key& getKey(Handle h) const
+    {
+        return _heap[_pos[h]].key;
+    }
+
+    /// Returns the handle with the smallest key. The queue must not be empty.
+    Handle getMin() const
+    {
+        return _heap[0].handle;
+    }
+
+    /// Returns the smallest key. The queue must not be empty.
+    const Key& getMinKey() const
+    {
+        return _heap[0].key;
+    }
+
+public:
+    // Queue modifying methods.
+
+    /// Puts into the queue a new handle \a h with the key \a k.
+    ///
+    /// The handle must be from [0, capacity) and must not be in the queue.
+    void insert(Handle h, const Key& k)
+    {
+        if (h >= _pos.size())
+            throw std::out_of_range("Handle exceeds the heap capacity");
+        if (_pos[h] != NPos)
+            throw std::invalid_argument("Handle is already in the heap");
+
+        std::size_t i = _size++;
+        _heap[i].key = k;
+        _heap[i].handle = h;
+        _pos[h] = i;
+        siftUp(i);
+    }
+
+    /// Sets the key of the handle \a h that is in the queue to \a k if it is
+    /// smaller than the current one.
+    ///
+    /// \return true if the key has been decreased, false otherwise.
+    bool decreaseKey(Handle h, const Key& k)
+    {
+        std::size_t i = _pos[h];
+        if (!_cmp(k, _heap[i].key))
+            return false;
+
+        _heap[i].key = k;
+        siftUp(i);
+        return true;
+    }
+
+    /// Inserts the handle \a h with the key \a k if it is not in the queue,
+    /// otherwise tries to decrease its key.
+    ///
+    /// \return true if the queue has been changed, false otherwise.
+    bool insertOrDecrease(Handle h, const Key& k)
+    {
+        if (!contains(h))
+        {
+            insert(h, k);
+            return true;
+        }
+
+        return decreaseKey(h, k);
+    }
+
+    /// Removes the handle with the smallest key from the queue and returns it.
+    /// The queue must not be empty.
+    Handle extractMin()
+    {
+        Handle top = _heap[0].handle;
+        removeAt(0);
+        return top;
+    }
+
+    /// Removes the handle \a h from the queue if it is there.
+    void remove(Handle h)
+    {
+        if (contains(h))
+            removeAt(_pos[h]);
+    }
+
+protected:
+    /// Element of the heap array: a key is stored next to its handle, so
+    /// sifting does not need to look anywhere else.
+    struct Node {
+        Key key;
+        Handle handle;
+    };
+
+    /// Removes the element at the position \a i of the heap array.
+    void removeAt(std::size_t i)
+    {
+        _pos[_heap[i].handle] = NPos;
+        if (i == --_size)
+            return;
+
+        place(i, _heap[_size]);
+        if (i > 0 && _cmp(_heap[i].key, _heap[(i - 1) / Arity].key))
+            siftUp(i);
+        else
+            siftDown(i);
+    }
+
+    /// Moves the element at the position \a i up until the heap property holds.
+    void siftUp(std::size_t i)
+    {
+        Node n = _heap[i];
+        while (i > 0)
+        {
+            std::size_t parent = (i - 1) / Arity;
+            if (!_cmp(n.key, _heap[parent].key))
+                break;
+
+            place(i, _heap[parent]);
+            i = parent;
+        }
+        place(i, n);
+    }
+
+    /// Moves the element at the position \a i down until the heap property
+    /// holds.
+    void siftDown(std::size_t i)
+    {
+        Node n = _heap[i];
+        for (;;)
+        {
+            std::size_t first = i * Arity + 1;
+            if (first >= _size)
+                break;
+
+            // looks for the smallest child
+            std::size_t last = first + Arity < _size ? first + Arity : _size;
+            std::size_t best = first;
+            for (std::size_t c = first + 1; c < last; ++c)
+                if (_cmp(_heap[c].key, _heap[best].key))
+                    best = c;
+
+            if (!_cmp(_heap[best].key, n.key))
+                break;
+
+            place(i, _heap[best]);
+            i = best;
+        }
+        place(i, n);
+    }
+
+    /// Puts the node \a n at the position \a i and updates its position.
+    void place(std::size_t i, const Node& n)
+    {
+        _heap[i] = n;
+        _pos[n.handle] = i;
+    }
+
+protected:
+    std::vector<Node> _heap;            ///< Heap array, first _size are used.
+    std::vector<std::size_t> _pos;      ///< Positions of handles in the heap.
+    std::size_t _size;                  ///< Number of elements in the heap.
+    Compare _cmp;                       ///< Keys comparator.
+}; // class IndexedDaryHeap
+
+template <typename Key, unsigned Arity, typename Compare>
+const std::size_t IndexedDaryHeap<Key, Arity, Compare>::NPos;
+
+
+
+#endif // INDEXED_HEAP_HPP
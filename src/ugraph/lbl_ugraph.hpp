@@ -17,13 +17,24 @@
 #define LBL_UGRAPH_HPP
 
 #include "ugraph.hpp"
+#include "csr_snapshot.hpp"
+#include "vertex_index.hpp"
 
 #include <map>
+#include <vector>
+#include <tuple>
+#include <iterator>
+#include <algorithm>
 
 /*! ****************************************************************************
  *  \brief The EdgeLblUGraph class represents a undirected graph with labels on
  *  edges..
  *
+ *  Labels are kept both by edges and in a labeled adjacency list, so the two
+ *  must change together with the edges. UGraph::addEdge() adds an edge without
+ *  a label, and removeEdge() is overridden to drop the label, so changing the
+ *  graph through a UGraph reference keeps them in sync.
+ *
  *  \tparam Vertex represents a type for vertices. See requirements for UGraph.
  *  \tparam EdgeLbl represents a type for edge labeling.
  ******************************************************************************/
@@ -41,6 +52,26 @@ public:
     /// Labeling function type for graph edges.
     typedef std::map<typename Base::Edge, EdgeLbl> EdgeLabeling;
     typedef typename EdgeLabeling::const_iterator EdgeLabelingCIter;
+    typedef std::pair<EdgeLabelingCIter, EdgeLabelingCIter> EdgeLabelingCIterPair;
+
+    /// Entry of a labeled adjacency list: a neighbour and the label of the
+    /// edge leading to it.
+    struct LblAdjEntry {
+        Vertex vertex;              ///< Neighbour.
+        EdgeLbl lbl;                ///< Label of the edge.
+    };
+
+    /// Labeled adjacency list. As in UGraph, every labeled edge is stored twice
+    /// (once for each of its vertices), but together with its label.
+    typedef std::multimap<Vertex, LblAdjEntry> LblAdjList;
+    typedef typename LblAdjList::const_iterator LblAdjListCIter;
+    typedef std::pair<LblAdjListCIter, LblAdjListCIter> LblAdjListCIterPair;
+
+    /// Labeled edge {s, d} for bulk addition.
+    typedef std::tuple<Vertex, Vertex, EdgeLbl> LblEdgeTuple;
+
+    /// Immutable compact copy of a graph.
+    typedef CsrSnapshot<Vertex, EdgeLbl> Snapshot;
 
 public:
     // Graph structure modifying methods.
@@ -53,11 +84,131 @@ public:
     Edge addLblEdge(Vertex s, Vertex d, EdgeLbl lbl)
     {
         Edge e = Base::addEdge(s, d);
-        _edgeLabeling.insert({e, lbl});
+        std::pair<typename EdgeLabeling::iterator, bool> ins = _edgeLabeling.insert({e, lbl});
+        if (ins.second)
+        {
+            _lblAdj.insert({e.first, LblAdjEntry{e.second, lbl}});
+            _lblAdj.insert({e.second, LblAdjEntry{e.first, lbl}});
+            return e;
+        }
+
+        // the edge is labeled already; the label and its copies are updated
+        ins.first->second = lbl;
+        setAdjLabels(e.first, e.second, lbl);
+        if (e.first != e.second)
+            setAdjLabels(e.second, e.first, lbl);
 
         return e;
     }
 
+    /// \brief Removes the edge {s, d} (or equivalent {d, s}) together with its
+    /// label from this graph; its vertices stay in the graph.
+    /// \return true if the edge has been removed, false if there was no such
+    /// edge.
+    bool removeEdge(Vertex s, Vertex d) override
+    {
+        if (!Base::removeEdge(s, d))
+            return false;
+
+        Edge e = Base::makeNormalizedEdge(s, d);
+        if (_edgeLabeling.erase(e))
+        {
+            removeAdjLabel(e.first, e.second);
+            removeAdjLabel(e.second, e.first);
+        }
+
+        return true;
+    }
+
+    /// \brief Adds into this graph all the labeled edges from the range
+    /// [\a first, \a last) of tuples {s, d, label} (e.g., LblEdgeTuple).
+    ///
+    /// Follows the same rule as addLblEdge() documents: a label of an edge
+    /// that is added again, either earlier in the range or before the call,
+    /// is updated by the later one. Edges are normalized, sorted and
+    /// deduplicated first and then put into the containers in one pass.
+    template <typename InputIt>
+    void addLblEdges(InputIt first, InputIt last)
+    {
+        typedef std::pair<Edge, EdgeLbl> LblEdge;
+
+        std::vector<LblEdge> batch;
+        for (; first != last; ++first)
+            batch.push_back(LblEdge(Base::makeNormalizedEdge(std::get<0>(*first),
+                                                             std::get<1>(*first)),
+                                    std::get<2>(*first)));
+
+        // a stable sort keeps the last label of an edge last among its copies
+        std::stable_sort(batch.begin(), batch.end(),
+            [](const LblEdge& a, const LblEdge& b) { return a.first < b.first; });
+
+        std::size_t uniqueNum = 0;
+        for (std::size_t i = 0; i < batch.size(); ++i)
+        {
+            if (i + 1 < batch.size() && batch[i + 1].first == batch[i].first)
+                continue;
+            batch[uniqueNum++] = batch[i];
+        }
+        batch.resize(uniqueNum);
+
+        std::vector<Edge> edges;
+        edges.reserve(batch.size());
+        for (const LblEdge& le : batch)
+            edges.push_back(le.first);
+        Base::addSortedEdges(edges);
+
+        // halves of edges that are labeled for the first time and halves of
+        // edges whose labels are updated
+        typedef std::pair<Vertex, LblAdjEntry> LblAdjHalf;
+        std::vector<LblAdjHalf> added, updated;
+
+        typename EdgeLabeling::iterator hint = _edgeLabeling.begin();
+        for (const LblEdge& le : batch)
+        {
+            std::size_t labeledNum = _edgeLabeling.size();
+            hint = _edgeLabeling.emplace_hint(hint, le.first, le.second);
+            hint->second = le.second;       // updates an existing label
+            ++hint;
+
+            std::vector<LblAdjHalf>& halves = (_edgeLabeling.size() != labeledNum)
+                ? added : updated;
+            halves.push_back(LblAdjHalf(le.first.first, LblAdjEntry{le.first.second, le.second}));
+            halves.push_back(LblAdjHalf(le.first.second, LblAdjEntry{le.first.first, le.second}));
+        }
+
+        auto halfLess = [](const LblAdjHalf& a, const LblAdjHalf& b)
+        {
+            return a.first < b.first
+                || (!(b.first < a.first) && a.second.vertex < b.second.vertex);
+        };
+        std::sort(added.begin(), added.end(), halfLess);
+        std::sort(updated.begin(), updated.end(), halfLess);
+
+        typename LblAdjList::iterator adjHint = _lblAdj.begin();
+        for (const LblAdjHalf& h : added)
+            adjHint = std::next(_lblAdj.insert(adjHint, h));
+
+        // the labeled adjacency of every vertex is scanned once for all its
+        // updated edges
+        for (std::size_t i = 0; i < updated.size(); )
+        {
+            std::size_t j = i;
+            while (j < updated.size() && !(updated[i].first < updated[j].first))
+                ++j;
+
+            std::pair<typename LblAdjList::iterator, typename LblAdjList::iterator> range
+                = _lblAdj.equal_range(updated[i].first);
+            for (typename LblAdjList::iterator it = range.first; it != range.second; ++it)
+            {
+                typename std::vector<LblAdjHalf>::const_iterator upd = std::lower_bound(
+                    updated.cbegin() + i, updated.cbegin() + j, *it, halfLess);
+                if (upd != updated.cbegin() + j && !halfLess(*it, *upd))
+                    it->second.lbl = upd->second.lbl;
+            }
+            i = j;
+        }
+    }
+
     /// For a given edge \a e tries to find an associated label and returns it
     /// if so.
     ///
@@ -78,8 +229,116 @@ public:
         return false;
     }
 
+    /// \brief Provides labeled edges adjacent to the vertex \a v as a semirange
+    /// of pairs {v, {neighbour, label}}.
+    ///
+    /// Unlike getAdjEdges(), labels are read directly from the entries, so no
+    /// lookup of getLabel() is needed for them. Unlabeled edges are skipped.
+    LblAdjListCIterPair getLblAdjEdges(const Vertex& v) const
+    {
+        return _lblAdj.equal_range(v);
+    }
+
+    /// Provides all the labeled edges as a semirange of pairs {edge, label},
+    /// where edges are normalized and ordered.
+    EdgeLabelingCIterPair getLblEdges() const
+    {
+        return {_edgeLabeling.begin(), _edgeLabeling.end()};
+    }
+
+    /// \brief Makes an immutable CSR snapshot of this graph.
+    ///
+    /// The snapshot does not depend on the graph, so the graph can be changed
+    /// or destroyed afterwards. Takes O(E log V) time.
+    Snapshot freeze() const
+    {
+        typedef typename Snapshot::AdjEntry AdjEntry;
+
+        VertexIndex<Vertex> index(*this);
+        std::vector<typename Snapshot::Offset> offsets;
+        std::vector<AdjEntry> adj;
+        offsets.reserve(index.getSize() + 1);
+        adj.reserve(Base::_edges.size());
+
+        auto entryLess = [](const AdjEntry& a, const AdjEntry& b)
+        {
+            return a.vertex < b.vertex;
+        };
+
+        // both adjacency lists are ordered by vertices in the same way as the
+        // set of vertices is, so each of them is visited exactly once; labeled
+        // entries of a vertex are a sub-multiset of all its entries
+        offsets.push_back(0);
+        std::vector<AdjEntry> labeled;
+        typename Base::AdjListCIter it = Base::_edges.begin();
+        LblAdjListCIter lblIt = _lblAdj.begin();
+        for (const Vertex& v : index.getVertices())
+        {
+            std::size_t first = adj.size();
+            for (; it != Base::_edges.end() && !(v < it->first); ++it)
+            {
+                AdjEntry e = AdjEntry();
+                e.vertex = index.getId(it->second);
+                adj.push_back(e);
+            }
+
+            labeled.clear();
+            for (; lblIt != _lblAdj.end() && !(v < lblIt->first); ++lblIt)
+            {
+                AdjEntry e = AdjEntry();
+                e.vertex = index.getId(lblIt->second.vertex);
+                e.lbl = lblIt->second.lbl;
+                e.hasLbl = true;
+                labeled.push_back(e);
+            }
+
+            std::sort(adj.begin() + first, adj.end(), entryLess);
+            std::sort(labeled.begin(), labeled.end(), entryLess);
+            typename std::vector<AdjEntry>::const_iterator lbl = labeled.begin();
+            for (std::size_t i = first; i < adj.size() && lbl != labeled.end(); ++i)
+            {
+                if (adj[i].vertex == lbl->vertex)
+                    adj[i] = *lbl++;
+            }
+
+            offsets.push_back(adj.size());
+        }
+
+        return Snapshot(index.release(), std::move(offsets), std::move(adj));
+    }
+
+protected:
+    /// Sets the label \a lbl to the entries \a d of the labeled adjacency list
+    /// of \a s.
+    void setAdjLabels(const Vertex& s, const Vertex& d, const EdgeLbl& lbl)
+    {
+        std::pair<typename LblAdjList::iterator, typename LblAdjList::iterator> range
+            = _lblAdj.equal_range(s);
+        for (typename LblAdjList::iterator it = range.first; it != range.second; ++it)
+        {
+            if (it->second.vertex == d)
+                it->second.lbl = lbl;
+        }
+    }
+
+    /// Removes one entry \a d from the labeled adjacency list of \a s.
+    void removeAdjLabel(const Vertex& s, const Vertex& d)
+    {
+        std::pair<typename LblAdjList::iterator, typename LblAdjList::iterator> range
+            = _lblAdj.equal_range(s);
+        for (typename LblAdjList::iterator it = range.first; it != range.second; ++it)
+        {
+            if (it->second.vertex == d)
+            {
+                _lblAdj.erase(it);
+                return;
+            }
+        }
+    }
+
 protected:
     EdgeLabeling _edgeLabeling;
+    LblAdjList _lblAdj;         ///< Labeled edges with their labels.
 };
 
 #endif // UGRAPH_HPP
@@ -0,0 +1,354 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a link-cut tree answering path maximum queries on a
+///             dynamic forest.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LINK_CUT_TREE_HPP
+#define LINK_CUT_TREE_HPP
+
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <cstddef>
+
+
+
+/*! ****************************************************************************
+ *  \brief The LinkCutTree class represents a forest of unrooted trees that
+ *  supports linking and cutting trees and finding the heaviest node on a path,
+ *  all in O(log n) amortized time.
+ *
+ *  Every tree is split into preferred paths kept in splay trees (Sleator and
+ *  Tarjan); a splay node knows the heaviest node of its subtree. Nodes may
+ *  carry keys or not; nodes without keys are never the heaviest ones, so a
+ *  graph is usually stored with vertices as such nodes and edges as nodes with
+ *  keys in the middle of them.
+ *
+ *  Nodes are numbers handed out by addNode() and kept in flat arrays; ids of
+ *  removed nodes are reused.
+ *
+ *  \tparam Key represents a type for keys.
+ *  \tparam Compare is a strict weak ordering for keys; the “greatest” key is
+ *  the heaviest one.
+ ******************************************************************************/
+template <typename Key, typename Compare = std::less<Key> >
+class LinkCutTree {
+public:
+    // type definitions
+
+    /// Node of the forest.
+    typedef std::size_t Node;
+
+    /// Denotes an absent node.
+    static const std::size_t NoNode = static_cast<std::size_t>(-1);
+
+public:
+    /// Creates an empty forest.
+    explicit LinkCutTree(const Compare& cmp = Compare())
+        : _cmp(cmp)
+    {
+    }
+
+    /// Removes all the nodes; does not free memory.
+    void clear()
+    {
+        _nodes.clear();
+        _free.clear();
+    }
+
+public:
+    // setters/getters
+
+    /// Returns the number of nodes that exist.
+    std::size_t getSize() const { return _nodes.size() - _free.size(); }
+
+    /// Returns the number of ids handed out; every node is less than it.
+    std::size_t getCapacity() const { return _nodes.size(); }
+
+    /// Determines whether the node \a x has a key.
+    bool hasKey(Node x) const { return _nodes[x].hasKey; }
+
+    /// Returns the key of the node \a x that must have one.
+    const Key& getKey(Node x) const { return _nodes[x].key; }
+
+public:
+    // Forest modifying methods.
+
+    /// Adds a new tree made of a single node without a key.
+    Node addNode()
+    {
+        return makeNode(Key(), false);
+    }
+
+    /// Adds a new tree made of a single node with the key \a k.
+    Node addNode(const Key& k)
+    {
+        return makeNode(k, true);
+    }
+
+    /// Removes the node \a x that must be a tree of its own (i.e., all its
+    /// links must be cut); its id may be handed out again.
+    void removeNode(Node x)
+    {
+        _nodes[x].hasKey = false;
+        _free.push_back(x);
+    }
+
+    /// Sets the key \a k to the node \a x that must have a key.
+    void setKey(Node x, const Key& k)
+    {
+        // x is the top of its splay tree then, so no other node keeps it as
+        // the heaviest one
+        access(x);
+        _nodes[x].key = k;
+        update(x);
+    }
+
+    /// Links the trees of the nodes \a x and \a y by the edge {x, y}.
+    ///
+    /// \throws std::invalid_argument if the nodes are in the same tree.
+    void link(Node x, Node y)
+    {
+        makeRoot(x);
+        if (findRoot(y) == x)
+            throw std::invalid_argument("Nodes are in the same tree already");
+
+        _nodes[x].parent = y;
+    }
+
+    /// Removes the edge {x, y} splitting its tree in two.
+    ///
+    /// \throws std::invalid_argument if the nodes are not linked directly.
+    void cut(Node x, Node y)
+    {
+        makeRoot(x);
+        access(y);
+
+        // the path x..y is the splay tree of y now; it is the edge {x, y} iff
+        // x is the only node before y
+        NodeData& ny = _nodes[y];
+        if (ny.child[0] != x)
+            throw std::invalid_argument("Nodes are not linked");
+        pushDown(x);
+        if (_nodes[x].child[1] != NoNode)
+            throw std::invalid_argument("Nodes are not linked");
+
+        ny.child[0] = NoNode;
+        _nodes[x].parent = NoNode;
+        update(y);
+    }
+
+public:
+    // Queries. They restructure the splay trees, hence are not const.
+
+    /// Returns the root of the tree of the node \a x; the root is chosen by
+    /// the last link(), cut() or a query and has no particular meaning.
+    Node findRoot(Node x)
+    {
+        access(x);
+        for (pushDown(x); _nodes[x].child[0] != NoNode; pushDown(x))
+            x = _nodes[x].child[0];
+        splay(x);
+
+        return x;
+    }
+
+    /// Determines whether the nodes \a x and \a y are in the same tree.
+    bool isConnected(Node x, Node y)
+    {
+        return x == y || findRoot(x) == findRoot(y);
+    }
+
+    /// Returns a node with the greatest key on the path between the nodes \a x
+    /// and \a y; returns NoNode if the nodes are in different trees or the
+    /// path has no nodes with keys.
+    Node findPathMax(Node x, Node y)
+    {
+        makeRoot(x);
+        if (findRoot(y) != x)
+            return NoNode;
+
+        // findRoot() has splayed x, so x is the top of the path x..y
+        access(y);
+        return _nodes[y].maxNode;
+    }
+
+protected:
+    /// Node of a splay tree. The parent of the top of a splay tree is the
+    /// node the preferred path hangs on (a path-parent pointer).
+    struct NodeData {
+        Node child[2];              ///< Nodes before and after this one.
+        Node parent;                ///< Parent or path-parent.
+        Node maxNode;               ///< Heaviest node of the subtree.
+        Key key;                    ///< Key if any.
+        bool hasKey;                ///< Whether the node has a key.
+        bool reversed;              ///< Pending reversal of the subtree.
+    };
+
+protected:
+    /// Makes a new isolated node.
+    Node makeNode(const Key& k, bool hasKey)
+    {
+        Node x;
+        if (_free.empty())
+        {
+            x = _nodes.size();
+            _nodes.push_back(NodeData());
+        }
+        else
+        {
+            x = _free.back();
+            _free.pop_back();
+        }
+
+        NodeData& nx = _nodes[x];
+        nx.child[0] = nx.child[1] = nx.parent = NoNode;
+        nx.maxNode = hasKey ? x : NoNode;
+        nx.key = k;
+        nx.hasKey = hasKey;
+        nx.reversed = false;
+
+        return x;
+    }
+
+    /// Determines whether the node \a x is the top of its splay tree.
+    bool isSplayRoot(Node x) const
+    {
+        Node p = _nodes[x].parent;
+        return p == NoNode || (_nodes[p].child[0] != x && _nodes[p].child[1] != x);
+    }
+
+    /// Returns the heavier of the nodes \a a and \a b (any can be NoNode).
+    Node getHeavier(Node a, Node b) const
+    {
+        if (a == NoNode)
+            return b;
+        if (b == NoNode)
+            return a;
+
+        return _cmp(_nodes[a].key, _nodes[b].key) ? b : a;
+    }
+
+    /// Recalculates the heaviest node of the subtree of \a x.
+    void update(Node x)
+    {
+        NodeData& nx = _nodes[x];
+        Node m = nx.child[0] == NoNode ? NoNode : _nodes[nx.child[0]].maxNode;
+        m = getHeavier(m, nx.hasKey ? x : NoNode);
+        if (nx.child[1] != NoNode)
+            m = getHeavier(m, _nodes[nx.child[1]].maxNode);
+        nx.maxNode = m;
+    }
+
+    /// Applies a pending reversal of the subtree of \a x to its children.
+    void pushDown(Node x)
+    {
+        NodeData& nx = _nodes[x];
+        if (!nx.reversed)
+            return;
+
+        std::swap(nx.child[0], nx.child[1]);
+        if (nx.child[0] != NoNode)
+            _nodes[nx.child[0]].reversed ^= true;
+        if (nx.child[1] != NoNode)
+            _nodes[nx.child[1]].reversed ^= true;
+        nx.reversed = false;
+    }
+
+    /// Rotates the node \a x above its parent.
+    void rotate(Node x)
+    {
+        Node y = _nodes[x].parent;
+        Node z = _nodes[y].parent;
+        const int dir = _nodes[y].child[1] == x ? 1 : 0;
+
+        if (!isSplayRoot(y))
+            _nodes[z].child[_nodes[z].child[1] == y ? 1 : 0] = x;
+        _nodes[x].parent = z;
+
+        Node b = _nodes[x].child[1 - dir];
+        _nodes[y].child[dir] = b;
+        if (b != NoNode)
+            _nodes[b].parent = y;
+
+        _nodes[x].child[1 - dir] = y;
+        _nodes[y].parent = x;
+
+        update(y);
+        update(x);
+    }
+
+    /// Moves the node \a x to the top of its splay tree.
+    void splay(Node x)
+    {
+        // pending reversals are applied top down first
+        _path.clear();
+        for (Node y = x; ; y = _nodes[y].parent)
+        {
+            _path.push_back(y);
+            if (isSplayRoot(y))
+                break;
+        }
+        for (std::size_t i = _path.size(); i > 0; --i)
+            pushDown(_path[i - 1]);
+
+        while (!isSplayRoot(x))
+        {
+            Node y = _nodes[x].parent;
+            if (!isSplayRoot(y))
+            {
+                Node z = _nodes[y].parent;
+                bool zigZig = (_nodes[z].child[0] == y) == (_nodes[y].child[0] == x);
+                rotate(zigZig ? y : x);
+            }
+            rotate(x);
+        }
+    }
+
+    /// Makes the path from the root of the tree to the node \a x preferred and
+    /// puts x to the top of its splay tree; x has nothing after it then.
+    void access(Node x)
+    {
+        Node last = NoNode;
+        for (Node y = x; y != NoNode; y = _nodes[y].parent)
+        {
+            splay(y);
+            _nodes[y].child[1] = last;
+            update(y);
+            last = y;
+        }
+        splay(x);
+    }
+
+    /// Makes the node \a x the root of its tree.
+    void makeRoot(Node x)
+    {
+        access(x);
+        _nodes[x].reversed ^= true;
+    }
+
+protected:
+    std::vector<NodeData> _nodes;       ///< All the nodes.
+    std::vector<Node> _free;            ///< Removed nodes to be reused.
+    std::vector<Node> _path;            ///< Buffer of splay().
+    Compare _cmp;                       ///< Ordering of keys.
+}; // class LinkCutTree
+
+template <typename Key, typename Compare>
+const std::size_t LinkCutTree<Key, Compare>::NoNode;
+
+
+
+#endif // LINK_CUT_TREE_HPP
@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains the front door to the MST engines choosing the cheapest
+///             one for a given graph.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MST_DISPATCH_HPP
+#define MST_DISPATCH_HPP
+
+#include <string>
+#include <iostream>
+#include <sstream>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <cstddef>
+
+#include "ugraph_algos.hpp"
+#include "simd_argmin.hpp"
+
+
+
+/// MST engines findMST() dispatches to.
+enum class MSTEngine {
+    Auto,           ///< Chosen by chooseMSTEngine().
+    PrimDense,      ///< findMSTPrimDense().
+    PrimHeap,       ///< findMSTPrimHeap().
+    Kruskal,        ///< findMSTKruskal().
+    Boruvka         ///< findMSTParallel().
+};
+
+/// Returns a name of the engine \a e as it is used by the benchmark.
+inline const char* getMSTEngineName(MSTEngine e)
+{
+    switch (e)
+    {
+    case MSTEngine::PrimDense:  return "prim_dense";
+    case MSTEngine::PrimHeap:   return "prim";
+    case MSTEngine::Kruskal:    return "kruskal";
+    case MSTEngine::Boruvka:    return "boruvka";
+    default:                    return "auto";
+    }
+}
+
+
+/*! ****************************************************************************
+ *  \brief The MSTCalibration struct keeps thresholds used to choose an MST
+ *  engine by the shape of a graph.
+ *
+ *  Densities are ratios of E to V (V - 1) / 2, degrees are ratios of 2E to V;
+ *  a density greater than 1 or a zero degree means "never". Default values are
+ *  measured by `bench --calibrate FILE` (see bench/mst_bench.cpp) on an x86-64
+ *  machine with g++ 12 and -O2, with and without AVX2. The same run on the
+ *  target machine makes a file for readMSTCalibration().
+ ******************************************************************************/
+struct MSTCalibration {
+#ifdef __AVX2__
+    /// Min density for dense Prim on an EdgeLblUGraph.
+    double denseDensityGraph = 0.05;
+
+    /// Min density for dense Prim on a CsrSnapshot.
+    double denseDensitySnapshot = 0.2;
+
+    /// Multiplies the above densities for weights findArgMin() is not
+    /// vectorized for.
+    double denseScalarFactor = 10;
+#else
+    double denseDensityGraph = 0.1;
+    double denseDensitySnapshot = 2;
+    double denseScalarFactor = 1;
+#endif
+
+    /// Max average degree for Kruskal's algorithm on an EdgeLblUGraph.
+    double kruskalMaxDegreeGraph = 64;
+
+    /// Max average degree for Kruskal's algorithm on a CsrSnapshot.
+    double kruskalMaxDegreeSnapshot = 0;
+
+    /// Min number of edges for Borůvka's algorithm when there are several
+    /// threads. The calibration machine had a single core, so there is no
+    /// measured default and Borůvka's algorithm is never chosen automatically
+    /// until a calibration file made on a multi-core machine is loaded.
+    std::size_t parallelMinEdges = static_cast<std::size_t>(-1);
+}; // struct MSTCalibration
+
+
+/// Writes the calibration \a c to the stream \a out as lines "name value".
+inline void writeMSTCalibration(std::ostream& out, const MSTCalibration& c)
+{
+    out << "dense_density_graph " << c.denseDensityGraph << "\n"
+        << "dense_density_snapshot " << c.denseDensitySnapshot << "\n"
+        << "dense_scalar_factor " << c.denseScalarFactor << "\n"
+        << "kruskal_max_degree_graph " << c.kruskalMaxDegreeGraph << "\n"
+        << "kruskal_max_degree_snapshot " << c.kruskalMaxDegreeSnapshot << "\n"
+        << "parallel_min_edges " << c.parallelMinEdges << "\n";
+}
+
+/// Reads a calibration written by writeMSTCalibration() from the stream
+/// \a in; values that are absent keep their defaults. Empty lines and lines
+/// starting with '#' are skipped.
+inline MSTCalibration readMSTCalibration(std::istream& in)
+{
+    MSTCalibration c;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream ls(line);
+        std::string name;
+        ls >> name;
+        if (name == "dense_density_graph")
+            ls >> c.denseDensityGraph;
+        else if (name == "dense_density_snapshot")
+            ls >> c.denseDensitySnapshot;
+        else if (name == "dense_scalar_factor")
+            ls >> c.denseScalarFactor;
+        else if (name == "kruskal_max_degree_graph")
+            ls >> c.kruskalMaxDegreeGraph;
+        else if (name == "kruskal_max_degree_snapshot")
+            ls >> c.kruskalMaxDegreeSnapshot;
+        else if (name == "parallel_min_edges")
+            ls >> c.parallelMinEdges;
+        else
+            throw std::invalid_argument("Unknown MST calibration value: " + name);
+
+        if (!ls)
+            throw std::invalid_argument("Malformed MST calibration value: " + name);
+    }
+
+    return c;
+}
+
+
+/// Options of findMST().
+struct MSTOptions {
+    /// Engine to use; Auto means the one chooseMSTEngine() suggests.
+    MSTEngine engine = MSTEngine::Auto;
+
+    /// Pool for Borůvka's algorithm; if null, a temporary pool of
+    /// threadsNum threads is made when it is needed.
+    WorkStealingPool* pool = nullptr;
+
+    /// Number of threads if there is no pool; 0 means the number of hardware
+    /// threads.
+    std::size_t threadsNum = 0;
+
+    /// Thresholds to choose an engine.
+    MSTCalibration calibration;
+
+    /// Returns the number of threads available to the engines.
+    std::size_t getAvailableThreads() const
+    {
+        if (pool)
+            return pool->getThreadsNum();
+        if (threadsNum)
+            return threadsNum;
+
+        std::size_t hw = std::thread::hardware_concurrency();
+        return hw ? hw : 1;
+    }
+}; // struct MSTOptions
+
+
+/// \brief Chooses the cheapest MST engine for a graph with \a verticesNum
+/// vertices and \a edgesNum edges.
+///
+/// \param isSnapshot whether the graph is a CsrSnapshot rather than an
+/// EdgeLblUGraph.
+/// \param isVectorized whether findArgMin() is vectorized for the weights.
+/// \param threadsNum number of threads available.
+inline MSTEngine chooseMSTEngine(std::size_t verticesNum, std::size_t edgesNum,
+                                 bool isSnapshot, bool isVectorized,
+                                 std::size_t threadsNum, const MSTCalibration& c)
+{
+    if (verticesNum < 2 || edgesNum == 0)
+        return MSTEngine::PrimHeap;
+
+    if (threadsNum > 1 && edgesNum >= c.parallelMinEdges)
+        return MSTEngine::Boruvka;
+
+    double minDensity = isSnapshot ? c.denseDensitySnapshot : c.denseDensityGraph;
+    if (!isVectorized)
+        minDensity *= c.denseScalarFactor;
+    if (isDenseGraph(verticesNum, edgesNum, minDensity))
+        return MSTEngine::PrimDense;
+
+    const double degree = 2.0 * edgesNum / verticesNum;
+    if (degree <= (isSnapshot ? c.kruskalMaxDegreeSnapshot : c.kruskalMaxDegreeGraph))
+        return MSTEngine::Kruskal;
+
+    return MSTEngine::PrimHeap;
+}
+
+
+/// Runs the engine given by the options \a opts (or chosen by
+/// chooseMSTEngine() if it is Auto) for the graph or the snapshot \a g.
+template<typename Vertex, typename EdgeLbl, typename TWeightTraits, typename TGraph>
+std::set<std::pair<Vertex, Vertex> >
+findMSTBy(const TGraph& g, bool isSnapshot, const MSTOptions& opts)
+{
+    MSTEngine engine = opts.engine;
+    if (engine == MSTEngine::Auto)
+    {
+        const bool isVectorized
+            = IsVectorizedArgMin<EdgeLbl, typename TWeightTraits::Compare>::value;
+        engine = chooseMSTEngine(g.getVerticesNum(), g.getEdgesNum(), isSnapshot,
+                                 isVectorized, opts.getAvailableThreads(), opts.calibration);
+    }
+
+    switch (engine)
+    {
+    case MSTEngine::PrimDense:
+        return findMSTPrimDense<Vertex, EdgeLbl, TWeightTraits>(g);
+    case MSTEngine::Kruskal:
+        return findMSTKruskal<Vertex, EdgeLbl, TWeightTraits>(g);
+    case MSTEngine::Boruvka:
+        if (opts.pool)
+            return findMSTParallel<Vertex, EdgeLbl, TWeightTraits>(g, *opts.pool);
+        return findMSTParallel<Vertex, EdgeLbl, TWeightTraits>(g, opts.threadsNum);
+    default:
+        return findMSTPrimHeap<Vertex, EdgeLbl, TWeightTraits>(g);
+    }
+}
+
+/// \brief Finds a MST for the given graph \a g using the engine that is the
+/// cheapest for its shape (see chooseMSTEngine()) or the one given by \a opts.
+///
+/// The contract is the same as for findMSTPrim(). If a graph has several MSTs,
+/// different engines may return different ones.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>
+findMST(const EdgeLblUGraph<Vertex, EdgeLbl>& g, const MSTOptions& opts = MSTOptions())
+{
+    return findMSTBy<Vertex, EdgeLbl, TWeightTraits>(g, false, opts);
+}
+
+/// Finds a MST for the given snapshot \a g using the cheapest engine.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename CsrSnapshot<Vertex, EdgeLbl>::Edge>
+findMST(const CsrSnapshot<Vertex, EdgeLbl>& g, const MSTOptions& opts = MSTOptions())
+{
+    return findMSTBy<Vertex, EdgeLbl, TWeightTraits>(g, true, opts);
+}
+
+
+
+#endif // MST_DISPATCH_HPP
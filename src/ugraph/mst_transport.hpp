@@ -0,0 +1,353 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains transports delivering messages between a coordinator
+///             and workers of partitioned algorithms.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+/// A transport is any class with the methods
+///   - std::size_t getWorkersNum() const;
+///   - void exchange(const std::vector<Message>& requests,
+///                   std::vector<Message>& replies);
+/// where exchange() delivers requests[i] to the worker i and collects its reply
+/// into replies[i] (a superstep). Workers are message handlers given to the
+/// constructor of a transport; a worker keeps its state between supersteps.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MST_TRANSPORT_HPP
+#define MST_TRANSPORT_HPP
+
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MST_TRANSPORT_USE_FORK
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#include "thread_pool.hpp"
+
+
+/// Message between a coordinator and a worker.
+typedef std::vector<char> TransportMessage;
+
+/// Worker of a transport: makes a reply to a request.
+typedef std::function<void(const TransportMessage& request,
+                           TransportMessage& reply)> TransportHandler;
+
+
+/// Appends the value \a x to the message \a m as it is in memory.
+template <typename T>
+void putMessageValue(TransportMessage& m, const T& x)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values can be sent");
+
+    const std::size_t at = m.size();
+    m.resize(at + sizeof(T));
+    std::memcpy(m.data() + at, &x, sizeof(T));
+}
+
+/// \brief Reads a value from the message \a m at the position \a pos and moves
+/// the position after it.
+///
+/// \throws std::out_of_range if the message is too short.
+template <typename T>
+T getMessageValue(const TransportMessage& m, std::size_t& pos)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values can be received");
+
+    if (m.size() < pos + sizeof(T))
+        throw std::out_of_range("Message is too short");
+
+    T x;
+    std::memcpy(&x, m.data() + pos, sizeof(T));
+    pos += sizeof(T);
+
+    return x;
+}
+
+
+/*! ****************************************************************************
+ *  \brief The InProcessTransport class calls workers directly, sequentially or
+ *  in parallel on a pool.
+ ******************************************************************************/
+class InProcessTransport {
+public:
+    /// Creates a transport with the given \a workers that run on the \a pool
+    /// if it is not null or sequentially otherwise.
+    explicit InProcessTransport(std::vector<TransportHandler> workers,
+                                WorkStealingPool* pool = nullptr)
+        : _workers(std::move(workers))
+        , _pool(pool)
+    {
+    }
+
+public:
+    // setters/getters
+    std::size_t getWorkersNum() const { return _workers.size(); }
+
+public:
+    /// Delivers requests[i] to the worker i and collects its reply into
+    /// replies[i].
+    void exchange(const std::vector<TransportMessage>& requests,
+                  std::vector<TransportMessage>& replies)
+    {
+        replies.resize(_workers.size());
+        auto run = [this, &requests, &replies](std::size_t from, std::size_t to)
+        {
+            for (std::size_t i = from; i < to; ++i)
+            {
+                replies[i].clear();
+                _workers[i](requests[i], replies[i]);
+            }
+        };
+
+        if (_pool)
+            _pool->parallelFor(0, _workers.size(), 1, run);
+        else
+            run(0, _workers.size());
+    }
+
+protected:
+    std::vector<TransportHandler> _workers;     ///< Workers.
+    WorkStealingPool* _pool;                    ///< Pool to run workers on.
+}; // class InProcessTransport
+
+
+#ifdef MST_TRANSPORT_USE_FORK
+
+/*! ****************************************************************************
+ *  \brief The ProcessTransport class runs every worker in a child process and
+ *  talks to it over a pair of pipes.
+ *
+ *  Children are forked by the constructor, so a worker takes its state from
+ *  the parent; after that the memory of the processes is separate, as on
+ *  different hosts. A message goes through a pipe as its 8-byte length
+ *  followed by its bytes. All the requests of a superstep are written before
+ *  any reply is read, so workers run in parallel.
+ *
+ *  A child exits when its request pipe is closed (by the destructor). A
+ *  failed worker makes exchange() throw std::runtime_error; the process must
+ *  ignore SIGPIPE for that to happen instead of being killed.
+ ******************************************************************************/
+class ProcessTransport {
+public:
+    /// Forks a child process for every worker of \a workers.
+    ///
+    /// \throws std::runtime_error if a pipe or a process can't be made.
+    explicit ProcessTransport(const std::vector<TransportHandler>& workers)
+    {
+        for (std::size_t i = 0; i < workers.size(); ++i)
+        {
+            int toChild[2], fromChild[2];
+            if (::pipe(toChild) != 0)
+            {
+                closeAll();
+                throw std::runtime_error("Can't make a pipe for a worker");
+            }
+            if (::pipe(fromChild) != 0)
+            {
+                ::close(toChild[0]);
+                ::close(toChild[1]);
+                closeAll();
+                throw std::runtime_error("Can't make a pipe for a worker");
+            }
+
+            const pid_t pid = ::fork();
+            if (pid < 0)
+            {
+                ::close(toChild[0]);
+                ::close(toChild[1]);
+                ::close(fromChild[0]);
+                ::close(fromChild[1]);
+                closeAll();
+                throw std::runtime_error("Can't start a worker process");
+            }
+
+            if (pid == 0)
+            {
+                // the child keeps only its own ends of its own pipes
+                ::close(toChild[1]);
+                ::close(fromChild[0]);
+                for (const Child& c : _children)
+                {
+                    ::close(c.requestFd);
+                    ::close(c.replyFd);
+                }
+                serve(workers[i], toChild[0], fromChild[1]);
+            }
+
+            ::close(toChild[0]);
+            ::close(fromChild[1]);
+            Child c = {pid, toChild[1], fromChild[0]};
+            _children.push_back(c);
+        }
+    }
+
+    /// Stops the children and waits for them.
+    ~ProcessTransport()
+    {
+        closeAll();
+    }
+
+    ProcessTransport(const ProcessTransport&) = delete;
+    ProcessTransport& operator=(const ProcessTransport&) = delete;
+
+public:
+    // setters/getters
+    std::size_t getWorkersNum() const { return _children.size(); }
+
+public:
+    /// \brief Delivers requests[i] to the worker i and collects its reply into
+    /// replies[i].
+    ///
+    /// \throws std::runtime_error if a worker process has failed.
+    void exchange(const std::vector<TransportMessage>& requests,
+                  std::vector<TransportMessage>& replies)
+    {
+        replies.resize(_children.size());
+        for (std::size_t i = 0; i < _children.size(); ++i)
+        {
+            if (!writeMessage(_children[i].requestFd, requests[i]))
+                throw std::runtime_error("Can't send a message to a worker process");
+        }
+        for (std::size_t i = 0; i < _children.size(); ++i)
+        {
+            if (!readMessage(_children[i].replyFd, replies[i]))
+                throw std::runtime_error("Can't receive a message from a worker process");
+        }
+    }
+
+protected:
+    /// Child process of a worker.
+    struct Child {
+        pid_t pid;                      ///< Process id.
+        int requestFd;                  ///< Pipe end requests are written to.
+        int replyFd;                    ///< Pipe end replies are read from.
+    };
+
+protected:
+    /// Closes the pipes of all the children and waits for them to exit.
+    void closeAll()
+    {
+        for (const Child& c : _children)
+        {
+            ::close(c.requestFd);
+            ::close(c.replyFd);
+        }
+        for (const Child& c : _children)
+        {
+            int status;
+            while (::waitpid(c.pid, &status, 0) < 0 && errno == EINTR)
+                ;
+        }
+        _children.clear();
+    }
+
+    /// Runs the \a worker on the messages from \a in until the pipe is closed;
+    /// never returns.
+    static void serve(const TransportHandler& worker, int in, int out)
+    {
+        TransportMessage request, reply;
+        int code = 0;
+        try
+        {
+            while (readMessage(in, request))
+            {
+                reply.clear();
+                worker(request, reply);
+                if (!writeMessage(out, reply))
+                {
+                    code = 1;
+                    break;
+                }
+            }
+        }
+        catch (...)
+        {
+            code = 1;
+        }
+
+        // no destructors or exit handlers of the parent must run here
+        ::_exit(code);
+    }
+
+    /// Writes \a n bytes from \a data to \a fd.
+    static bool writeBytes(int fd, const char* data, std::size_t n)
+    {
+        while (n)
+        {
+            const ssize_t k = ::write(fd, data, n);
+            if (k < 0 && errno == EINTR)
+                continue;
+            if (k <= 0)
+                return false;
+            data += k;
+            n -= static_cast<std::size_t>(k);
+        }
+
+        return true;
+    }
+
+    /// Reads \a n bytes from \a fd into \a data.
+    static bool readBytes(int fd, char* data, std::size_t n)
+    {
+        while (n)
+        {
+            const ssize_t k = ::read(fd, data, n);
+            if (k < 0 && errno == EINTR)
+                continue;
+            if (k <= 0)
+                return false;
+            data += k;
+            n -= static_cast<std::size_t>(k);
+        }
+
+        return true;
+    }
+
+    static bool writeMessage(int fd, const TransportMessage& m)
+    {
+        const std::uint64_t len = m.size();
+        return writeBytes(fd, reinterpret_cast<const char*>(&len), sizeof(len))
+               && writeBytes(fd, m.data(), m.size());
+    }
+
+    static bool readMessage(int fd, TransportMessage& m)
+    {
+        std::uint64_t len;
+        if (!readBytes(fd, reinterpret_cast<char*>(&len), sizeof(len)))
+            return false;
+
+        m.resize(static_cast<std::size_t>(len));
+        return readBytes(fd, m.data(), m.size());
+    }
+
+protected:
+    std::vector<Child> _children;       ///< Worker processes.
+}; // class ProcessTransport
+
+#endif // MST_TRANSPORT_USE_FORK
+
+
+
+#endif // MST_TRANSPORT_HPP
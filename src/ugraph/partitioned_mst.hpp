@@ -0,0 +1,447 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains Borůvka's algorithm for graphs partitioned between
+///             workers that talk through a transport.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+/// Messages of a round (see mst_transport.hpp):
+///   - request: the number k of label changes, then k pairs of a local vertex
+///     id and its new component label;
+///   - reply: the number l of the vertices of the worker (all of them in the
+///     first round and none later), then their ids; then the number m of
+///     candidates, then m lightest edges (IdEdge) leaving components among the
+///     edges of the worker.
+///
+/// Local ids number the vertices of a worker (the ends of its edges) in the
+/// order of their ids. The coordinator labels a component by the smallest
+/// local id of its vertices, so labels are local ids too.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PARTITIONED_MST_HPP
+#define PARTITIONED_MST_HPP
+
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+#include "ugraph_algos.hpp"
+#include "mst_transport.hpp"
+
+
+/// Transports findMSTPartitioned() can run workers on.
+enum class MSTTransportKind {
+    InProcess,      ///< InProcessTransport.
+    Processes       ///< ProcessTransport.
+};
+
+
+/// Determines whether the edge \a a goes before the edge \a b in Kruskal's
+/// algorithm (see sortIdEdges()).
+template<typename TWeightTraits, typename EdgeLbl>
+bool isIdEdgeBefore(const IdEdge<EdgeLbl>& a, const IdEdge<EdgeLbl>& b)
+{
+    typename TWeightTraits::Compare less;
+    if (less(a.lbl, b.lbl))
+        return true;
+    if (less(b.lbl, a.lbl))
+        return false;
+
+    return a.s < b.s || (a.s == b.s && a.d < b.d);
+}
+
+
+/*! ****************************************************************************
+ *  \brief The BoruvkaPartWorker class is a worker of the partitioned Borůvka's
+ *  algorithm owning a part of the edges of a graph.
+ *
+ *  The worker only knows the vertices of its edges (the owned ones and the
+ *  boundary ones) by local ids, and the components of them by labels the
+ *  coordinator assigns, so its memory is linear in the number of its edges.
+ *  Edges inside components are dropped, so the work of rounds decreases.
+ *
+ *  \tparam EdgeLbl represents a type for edge labels; must be trivially
+ *  copyable.
+ *  \tparam TWeightTraits describes labels as weights (see WeightTraits).
+ ******************************************************************************/
+template<typename EdgeLbl, typename TWeightTraits = WeightTraits<EdgeLbl> >
+class BoruvkaPartWorker {
+public:
+    /// Creates a worker owning the \a edges.
+    explicit BoruvkaPartWorker(std::vector<IdEdge<EdgeLbl> > edges)
+        : _edges(std::move(edges))
+        , _isFirstRound(true)
+    {
+        for (const IdEdge<EdgeLbl>& e : _edges)
+        {
+            _vertices.push_back(e.s);
+            _vertices.push_back(e.d);
+        }
+        std::sort(_vertices.begin(), _vertices.end());
+        _vertices.erase(std::unique(_vertices.begin(), _vertices.end()), _vertices.end());
+
+        for (IdEdge<EdgeLbl>& e : _edges)
+        {
+            e.s = getLocalId(e.s);
+            e.d = getLocalId(e.d);
+        }
+
+        _labels.resize(_vertices.size());
+        for (std::size_t i = 0; i < _labels.size(); ++i)
+            _labels[i] = static_cast<VertexId>(i);
+        _best.assign(_vertices.size(), NoEdge);
+    }
+
+    /// Applies the label changes from the \a request and makes a \a reply
+    /// with the lightest edges leaving components.
+    ///
+    /// \throws std::out_of_range if the request refers to a wrong local id.
+    void operator()(const TransportMessage& request, TransportMessage& reply)
+    {
+        std::size_t pos = 0;
+        const std::uint64_t changesNum = getMessageValue<std::uint64_t>(request, pos);
+        for (std::uint64_t i = 0; i < changesNum; ++i)
+        {
+            const VertexId v = getMessageValue<VertexId>(request, pos);
+            const VertexId label = getMessageValue<VertexId>(request, pos);
+            if (v >= _labels.size() || label >= _labels.size())
+                throw std::out_of_range("Coordinator sent a wrong label");
+            _labels[v] = label;
+        }
+
+        std::size_t w = 0;
+        for (std::size_t r = 0; r < _edges.size(); ++r)
+        {
+            const VertexId cs = _labels[_edges[r].s];
+            const VertexId cd = _labels[_edges[r].d];
+            if (cs == cd)
+                continue;                           // the edge is inside
+
+            _edges[w] = _edges[r];
+            relax(cs, w);
+            relax(cd, w);
+            ++w;
+        }
+        _edges.resize(w);
+
+        if (_isFirstRound)
+        {
+            putMessageValue<std::uint64_t>(reply, _vertices.size());
+            for (VertexId v : _vertices)
+                putMessageValue(reply, v);
+            _isFirstRound = false;
+        }
+        else
+            putMessageValue<std::uint64_t>(reply, 0);
+
+        putMessageValue<std::uint64_t>(reply, _touched.size());
+        for (VertexId c : _touched)
+        {
+            IdEdge<EdgeLbl> e = _edges[_best[c]];
+            e.s = _vertices[e.s];
+            e.d = _vertices[e.d];
+            putMessageValue(reply, e);
+            _best[c] = NoEdge;
+        }
+        _touched.clear();
+    }
+
+public:
+    // setters/getters
+
+    /// Returns the number of edges between components left.
+    std::size_t getEdgesNum() const { return _edges.size(); }
+
+    /// Returns the number of vertices the worker knows.
+    std::size_t getVerticesNum() const { return _vertices.size(); }
+
+protected:
+    /// Returns the local id of the vertex \a v of an edge of the worker.
+    VertexId getLocalId(VertexId v) const
+    {
+        return static_cast<VertexId>(std::lower_bound(_vertices.begin(), _vertices.end(), v)
+                                     - _vertices.begin());
+    }
+
+    /// Makes the edge at the position \a e the best one of the component
+    /// labeled \a c if it is lighter.
+    void relax(VertexId c, std::size_t e)
+    {
+        std::size_t& b = _best[c];
+        if (b == NoEdge)
+        {
+            b = e;
+            _touched.push_back(c);
+        }
+        else if (isIdEdgeBefore<TWeightTraits>(_edges[e], _edges[b]))
+            b = e;
+    }
+
+protected:
+    static const std::size_t NoEdge = static_cast<std::size_t>(-1);
+
+    std::vector<IdEdge<EdgeLbl> > _edges;       ///< Edges between components by local ids.
+    std::vector<VertexId> _vertices;            ///< Vertex ids by local ids.
+    std::vector<VertexId> _labels;              ///< Component labels by local ids.
+    std::vector<std::size_t> _best;             ///< Best edges by component labels.
+    std::vector<VertexId> _touched;             ///< Labels of components with best edges.
+    bool _isFirstRound;                         ///< Whether the vertices are to be sent.
+}; // class BoruvkaPartWorker
+
+template<typename EdgeLbl, typename TWeightTraits>
+const std::size_t BoruvkaPartWorker<EdgeLbl, TWeightTraits>::NoEdge;
+
+
+/// \brief Splits the labeled \a edges of a graph with \a verticesNum vertices
+/// between \a workersNum workers of the partitioned Borůvka's algorithm.
+///
+/// Vertex ids are split into equal contiguous ranges; a worker owns the edges
+/// whose smaller ends are in its range.
+template<typename EdgeLbl, typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::vector<TransportHandler>
+makeBoruvkaPartWorkers(std::size_t verticesNum, const std::vector<IdEdge<EdgeLbl> >& edges,
+                       std::size_t workersNum)
+{
+    std::vector<std::vector<IdEdge<EdgeLbl> > > parts(workersNum);
+    for (const IdEdge<EdgeLbl>& e : edges)
+    {
+        const std::size_t w = static_cast<std::size_t>(
+            static_cast<std::uint64_t>(std::min(e.s, e.d)) * workersNum / verticesNum);
+        parts[w].push_back(e);
+    }
+
+    std::vector<TransportHandler> workers;
+    workers.reserve(workersNum);
+    for (std::size_t w = 0; w < workersNum; ++w)
+        workers.push_back(BoruvkaPartWorker<EdgeLbl, TWeightTraits>(std::move(parts[w])));
+
+    return workers;
+}
+
+/// \brief Coordinates rounds of the partitioned Borůvka's algorithm for a graph
+/// with \a verticesNum vertices whose workers are reached by the \a transport;
+/// returns the edges of a minimum spanning forest in the order of rounds.
+///
+/// Every round the workers send the lightest edges leaving components among
+/// their edges, the coordinator picks the lightest one for every component and
+/// sends every worker the new labels of its vertices whose components have
+/// been merged. Components of candidates are found by the coordinator from
+/// their ends, so workers' labels are never trusted. Edges with equal labels
+/// are ordered by their ends, so the result is the same as the one of
+/// findMSTKruskal().
+///
+/// \throws std::out_of_range if a worker sends a wrong vertex id.
+template<typename TWeightTraits, typename EdgeLbl, typename TTransport>
+std::vector<std::pair<VertexId, VertexId> >
+findMSTPartitionedOnTransport(std::size_t verticesNum, TTransport& transport)
+{
+    const std::size_t n = verticesNum;
+    const std::size_t workersNum = transport.getWorkersNum();
+    DisjointSet components(n);
+    std::vector<IdEdge<EdgeLbl> > best(n);
+    std::vector<bool> hasBest(n, false);
+    std::vector<VertexId> touched;
+
+    // vertices of workers by local ids, and the labels the workers have
+    std::vector<std::vector<VertexId> > vertices(workersNum);
+    std::vector<std::vector<VertexId> > labels(workersNum);
+    std::vector<VertexId> labelOfRoot(n);
+    std::vector<std::size_t> labelEpoch(n, 0);
+    std::size_t epoch = 0;
+    std::vector<std::pair<VertexId, VertexId> > changes;
+
+    std::vector<std::pair<VertexId, VertexId> > res;
+    std::vector<TransportMessage> requests(workersNum);
+    std::vector<TransportMessage> replies;
+    for (TransportMessage& request : requests)
+        putMessageValue<std::uint64_t>(request, 0);
+
+    auto relax = [&](VertexId c, const IdEdge<EdgeLbl>& e)
+    {
+        if (!hasBest[c])
+        {
+            hasBest[c] = true;
+            best[c] = e;
+            touched.push_back(c);
+        }
+        else if (isIdEdgeBefore<TWeightTraits>(e, best[c]))
+            best[c] = e;
+    };
+
+    for (;;)
+    {
+        transport.exchange(requests, replies);
+
+        for (std::size_t w = 0; w < workersNum; ++w)
+        {
+            const TransportMessage& reply = replies[w];
+            std::size_t pos = 0;
+            const std::uint64_t l = getMessageValue<std::uint64_t>(reply, pos);
+            for (std::uint64_t i = 0; i < l; ++i)
+            {
+                const VertexId v = getMessageValue<VertexId>(reply, pos);
+                if (v >= n)
+                    throw std::out_of_range("Worker sent a wrong vertex");
+                labels[w].push_back(static_cast<VertexId>(vertices[w].size()));
+                vertices[w].push_back(v);
+            }
+
+            const std::uint64_t m = getMessageValue<std::uint64_t>(reply, pos);
+            for (std::uint64_t i = 0; i < m; ++i)
+            {
+                const IdEdge<EdgeLbl> e = getMessageValue<IdEdge<EdgeLbl> >(reply, pos);
+                if (e.s >= n || e.d >= n)
+                    throw std::out_of_range("Worker sent a wrong vertex");
+
+                const VertexId cs = static_cast<VertexId>(components.find(e.s));
+                const VertexId cd = static_cast<VertexId>(components.find(e.d));
+                if (cs == cd)
+                    continue;
+                relax(cs, e);
+                relax(cd, e);
+            }
+        }
+
+        // the same edge may be the best one for both of its components
+        const std::size_t first = res.size();
+        std::sort(touched.begin(), touched.end());
+        for (VertexId c : touched)
+        {
+            hasBest[c] = false;
+            if (components.unite(best[c].s, best[c].d))
+                res.push_back(std::make_pair(best[c].s, best[c].d));
+        }
+        touched.clear();
+
+        if (res.size() == first)
+            break;
+
+        // a component is labeled by the smallest local id of its vertices
+        for (std::size_t w = 0; w < workersNum; ++w)
+        {
+            ++epoch;
+            changes.clear();
+            for (std::size_t i = 0; i < vertices[w].size(); ++i)
+            {
+                const std::size_t root = components.find(vertices[w][i]);
+                if (labelEpoch[root] != epoch)
+                {
+                    labelEpoch[root] = epoch;
+                    labelOfRoot[root] = static_cast<VertexId>(i);
+                }
+                if (labels[w][i] != labelOfRoot[root])
+                {
+                    labels[w][i] = labelOfRoot[root];
+                    changes.push_back(std::make_pair(static_cast<VertexId>(i), labels[w][i]));
+                }
+            }
+
+            requests[w].clear();
+            putMessageValue<std::uint64_t>(requests[w], changes.size());
+            for (const std::pair<VertexId, VertexId>& c : changes)
+            {
+                putMessageValue(requests[w], c.first);
+                putMessageValue(requests[w], c.second);
+            }
+        }
+    }
+
+    return res;
+}
+
+/// \brief Finds a minimum spanning forest of a graph with \a vertices given by
+/// the array of its labeled \a edges using the partitioned Borůvka's algorithm
+/// with \a workersNum workers on a transport of the given \a kind.
+///
+/// \throws std::invalid_argument if \a workersNum is 0.
+/// \throws std::runtime_error if worker processes can't be used.
+template<typename Vertex, typename TWeightTraits, typename EdgeLbl, typename TVertexTable>
+std::set<std::pair<Vertex, Vertex> >
+findMSTPartitionedOnEdges(const TVertexTable& vertices, std::size_t verticesNum,
+                          const std::vector<IdEdge<EdgeLbl> >& edges,
+                          std::size_t workersNum, MSTTransportKind kind)
+{
+    if (workersNum == 0)
+        throw std::invalid_argument("There must be workers");
+
+    std::set<std::pair<Vertex, Vertex> > res;
+    if (verticesNum == 0)
+        return res;
+
+    std::vector<TransportHandler> workers
+        = makeBoruvkaPartWorkers<EdgeLbl, TWeightTraits>(verticesNum, edges, workersNum);
+
+    std::vector<std::pair<VertexId, VertexId> > chosen;
+    if (kind == MSTTransportKind::Processes)
+    {
+#ifdef MST_TRANSPORT_USE_FORK
+        ProcessTransport transport(workers);
+        workers.clear();                            // the children own them now
+        chosen = findMSTPartitionedOnTransport<TWeightTraits, EdgeLbl>(verticesNum,
+                                                                       transport);
+#else
+        throw std::runtime_error("Worker processes are not supported");
+#endif
+    }
+    else
+    {
+        InProcessTransport transport(std::move(workers));
+        chosen = findMSTPartitionedOnTransport<TWeightTraits, EdgeLbl>(verticesNum,
+                                                                       transport);
+    }
+
+    // ids are ordered as vertices are and s < d, so edges are normalized
+    for (const std::pair<VertexId, VertexId>& e : chosen)
+        res.insert(std::make_pair(vertices.getVertex(e.first), vertices.getVertex(e.second)));
+
+    return res;
+}
+
+/// \brief Finds a MST for the given graph \a g using Borůvka's algorithm with
+/// the graph partitioned between \a workersNum workers on a transport of the
+/// given \a kind.
+///
+/// The contract is the same as for findMSTPrim(); the edges are the same as
+/// the ones of findMSTKruskal().
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>
+findMSTPartitioned(const EdgeLblUGraph<Vertex, EdgeLbl>& g, std::size_t workersNum,
+                   MSTTransportKind kind = MSTTransportKind::InProcess)
+{
+    const VertexIndex<Vertex> index(g);
+    std::vector<IdEdge<EdgeLbl> > edges = makeIdEdges(g, index);
+
+    return findMSTPartitionedOnEdges<Vertex, TWeightTraits>(index, index.getSize(), edges,
+                                                            workersNum, kind);
+}
+
+/// Finds a MST for the given snapshot \a g using Borůvka's algorithm with the
+/// graph partitioned between \a workersNum workers.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename CsrSnapshot<Vertex, EdgeLbl>::Edge>
+findMSTPartitioned(const CsrSnapshot<Vertex, EdgeLbl>& g, std::size_t workersNum,
+                   MSTTransportKind kind = MSTTransportKind::InProcess)
+{
+    std::vector<IdEdge<EdgeLbl> > edges = makeIdEdges(g);
+
+    return findMSTPartitionedOnEdges<Vertex, TWeightTraits>(g, g.getVerticesNum(), edges,
+                                                            workersNum, kind);
+}
+
+
+
+#endif // PARTITIONED_MST_HPP
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains functions searching for the least element of an array,
+///             vectorized with AVX2 where it is available.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+/// Vectorized versions are compiled if the compiler targets AVX2 (e.g., with
+/// -mavx2 or the UGRAPH_USE_AVX2 CMake option), otherwise the scalar version
+/// is used for all types.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SIMD_ARGMIN_HPP
+#define SIMD_ARGMIN_HPP
+
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "weight_traits.hpp"
+
+
+/// Finds the position of the least of \a n \a keys according to \a cmp; the
+/// first one is taken among equal keys. Returns 0 if \a n is 0.
+template <typename Key, typename Compare>
+std::size_t findArgMin(const Key* keys, std::size_t n, Compare cmp)
+{
+    std::size_t best = 0;
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        if (cmp(keys[i], keys[best]))
+            best = i;
+    }
+
+    return best;
+}
+
+
+/// Determines whether findArgMin() is vectorized for keys of the type \a Key
+/// compared by \a Compare.
+template <typename Key, typename Compare>
+struct IsVectorizedArgMin : std::false_type {};
+
+
+#ifdef __AVX2__
+
+template <>
+struct IsVectorizedArgMin<std::int32_t, std::less<std::int32_t> > : std::true_type {};
+
+template <>
+struct IsVectorizedArgMin<float, WeightTraits<float>::Compare> : std::true_type {};
+
+/// Returns the position of the first set bit of a nonzero \a mask.
+inline std::size_t findFirstBit(unsigned mask)
+{
+    std::size_t pos = 0;
+    for (; !(mask & 1); mask >>= 1)
+        ++pos;
+
+    return pos;
+}
+
+/// Vectorized findArgMin() for 32-bit integers.
+///
+/// The first pass finds the least value with 8 lanes at once, the second one
+/// finds its first occurrence.
+inline std::size_t findArgMin(const std::int32_t* keys, std::size_t n,
+                              std::less<std::int32_t>)
+{
+    if (n < 16)
+        return findArgMin(keys, n, [](std::int32_t a, std::int32_t b) { return a < b; });
+
+    __m256i best = _mm256_set1_epi32(std::numeric_limits<std::int32_t>::max());
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        best = _mm256_min_epi32(best, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)));
+
+    alignas(32) std::int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), best);
+    std::int32_t m = lanes[0];
+    for (int l = 1; l < 8; ++l)
+        m = lanes[l] < m ? lanes[l] : m;
+    for (; i < n; ++i)
+        m = keys[i] < m ? keys[i] : m;
+
+    const __m256i mv = _mm256_set1_epi32(m);
+    for (i = 0; i + 8 <= n; i += 8)
+    {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), mv);
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+        if (mask)
+            return i + findFirstBit(mask);
+    }
+    for (; keys[i] != m; ++i)
+        ;
+
+    return i;
+}
+
+/// Vectorized findArgMin() for floats ordered by WeightTraits.
+///
+/// NaNs are skipped by the vectorized passes as the heaviest keys; if there
+/// are only NaNs, the scalar version decides.
+inline std::size_t findArgMin(const float* keys, std::size_t n,
+                              WeightTraits<float>::Compare cmp)
+{
+    if (n < 16)
+        return findArgMin<float, WeightTraits<float>::Compare>(keys, n, cmp);
+
+    // _mm256_min_ps() returns the second operand if any of them is NaN
+    __m256 best = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        best = _mm256_min_ps(_mm256_loadu_ps(keys + i), best);
+
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, best);
+    float m = lanes[0];
+    for (int l = 1; l < 8; ++l)
+        m = lanes[l] < m ? lanes[l] : m;
+    for (; i < n; ++i)
+        m = keys[i] < m ? keys[i] : m;
+
+    const __m256 mv = _mm256_set1_ps(m);
+    for (i = 0; i + 8 <= n; i += 8)
+    {
+        __m256 eq = _mm256_cmp_ps(_mm256_loadu_ps(keys + i), mv, _CMP_EQ_OQ);
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(eq));
+        if (mask)
+            return i + findFirstBit(mask);
+    }
+    for (; i < n; ++i)
+    {
+        if (keys[i] == m)
+            return i;
+    }
+
+    return findArgMin<float, WeightTraits<float>::Compare>(keys, n, cmp);
+}
+
+#endif // __AVX2__
+
+
+
+#endif // SIMD_ARGMIN_HPP
@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains algorithms building minimum spanning forests grouped by
+///             connected components.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPANNING_FOREST_HPP
+#define SPANNING_FOREST_HPP
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+#include "ugraph_algos.hpp"
+
+
+
+/// Connected component of a graph together with its minimum spanning tree.
+template<typename Vertex, typename EdgeLbl>
+struct ForestComponent
+{
+    /// Number of the component; components are numbered by their least
+    /// vertices in ascending order.
+    std::size_t id;
+
+    /// Vertices of the component in ascending order.
+    std::vector<Vertex> vertices;
+
+    /// Edges of the MST of the component in ascending order of labels.
+    std::vector<LblEdge<Vertex, EdgeLbl> > edges;
+
+    /// Total label of the edges.
+    EdgeLbl weight;
+};
+
+
+/// \brief Finds a minimum spanning forest of a graph with \a vertices given by
+/// the array of its labeled \a edges and groups it by connected components.
+///
+/// Components are found by a disjoint-set structure in one pass over the
+/// edges, then the edges are bucketed by components, and Kruskal's algorithm
+/// runs for every component separately on the \a pool. Tasks take components
+/// in the descending order of sizes with a stride, so a few huge components
+/// do not end up in the same task.
+template<typename Vertex, typename TWeightTraits, typename EdgeLbl, typename TVertexTable>
+std::vector<ForestComponent<Vertex, EdgeLbl> >
+findSpanningForestOnEdges(const TVertexTable& vertices, std::size_t verticesNum,
+                          const std::vector<IdEdge<EdgeLbl> >& edges, WorkStealingPool& pool)
+{
+    const std::size_t n = verticesNum;
+    const VertexId NoId = static_cast<VertexId>(-1);
+
+    DisjointSet ds(n);
+    for (const IdEdge<EdgeLbl>& e : edges)
+        ds.unite(e.s, e.d);
+
+    // components are numbered in the order of their least vertices
+    std::vector<VertexId> compOf(n);
+    std::vector<VertexId> compOfRoot(n, NoId);
+    std::size_t compsNum = 0;
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        VertexId& c = compOfRoot[ds.find(v)];
+        if (c == NoId)
+            c = static_cast<VertexId>(compsNum++);
+        compOf[v] = c;
+    }
+
+    // vertices and edges are bucketed by components keeping their order;
+    // local ids are positions of vertices in their components
+    std::vector<std::size_t> vertexStarts(compsNum + 1, 0);
+    std::vector<std::size_t> edgeStarts(compsNum + 1, 0);
+    for (std::size_t v = 0; v < n; ++v)
+        ++vertexStarts[compOf[v] + 1];
+    for (const IdEdge<EdgeLbl>& e : edges)
+        ++edgeStarts[compOf[e.s] + 1];
+    for (std::size_t c = 0; c < compsNum; ++c)
+    {
+        vertexStarts[c + 1] += vertexStarts[c];
+        edgeStarts[c + 1] += edgeStarts[c];
+    }
+
+    std::vector<VertexId> compVertices(n);
+    std::vector<VertexId> localIds(n);
+    std::vector<std::size_t> pos(vertexStarts.begin(), vertexStarts.end() - 1);
+    for (std::size_t v = 0; v < n; ++v)
+    {
+        localIds[v] = static_cast<VertexId>(pos[compOf[v]] - vertexStarts[compOf[v]]);
+        compVertices[pos[compOf[v]]++] = static_cast<VertexId>(v);
+    }
+
+    std::vector<IdEdge<EdgeLbl> > compEdges(edges.size());
+    pos.assign(edgeStarts.begin(), edgeStarts.end() - 1);
+    for (const IdEdge<EdgeLbl>& e : edges)
+    {
+        IdEdge<EdgeLbl> local = {localIds[e.s], localIds[e.d], e.lbl};
+        compEdges[pos[compOf[e.s]]++] = local;
+    }
+
+    std::vector<VertexId> order(compsNum);
+    for (std::size_t c = 0; c < compsNum; ++c)
+        order[c] = static_cast<VertexId>(c);
+    std::stable_sort(order.begin(), order.end(), [&edgeStarts](VertexId a, VertexId b)
+        {
+            return edgeStarts[a + 1] - edgeStarts[a] > edgeStarts[b + 1] - edgeStarts[b];
+        });
+
+    std::vector<ForestComponent<Vertex, EdgeLbl> > res(compsNum);
+    const std::size_t tasksNum = std::min(compsNum, pool.getThreadsNum() * 4);
+    pool.parallelFor(0, tasksNum, 1, [&](std::size_t from, std::size_t to)
+    {
+        DisjointSet trees;
+        for (std::size_t t = from; t < to; ++t)
+        {
+            for (std::size_t i = t; i < compsNum; i += tasksNum)
+            {
+                const VertexId c = order[i];
+                const VertexId* cv = compVertices.data() + vertexStarts[c];
+                ForestComponent<Vertex, EdgeLbl>& comp = res[c];
+                comp.id = c;
+                comp.weight = TWeightTraits::zero();
+                comp.vertices.reserve(vertexStarts[c + 1] - vertexStarts[c]);
+                for (std::size_t v = vertexStarts[c]; v < vertexStarts[c + 1]; ++v)
+                    comp.vertices.push_back(vertices.getVertex(compVertices[v]));
+
+                // local ids keep the order of ids, so ties are broken as by
+                // findMSTKruskal()
+                auto first = compEdges.begin() + edgeStarts[c];
+                auto last = compEdges.begin() + edgeStarts[c + 1];
+                sortIdEdges<TWeightTraits>(first, last);
+
+                trees.reset(comp.vertices.size());
+                comp.edges.reserve(comp.vertices.size() - 1);
+                for (auto it = first; it != last && trees.getSetsNum() > 1; ++it)
+                {
+                    if (!trees.unite(it->s, it->d))
+                        continue;
+
+                    LblEdge<Vertex, EdgeLbl> e = {vertices.getVertex(cv[it->s]),
+                                                  vertices.getVertex(cv[it->d]), it->lbl};
+                    comp.edges.push_back(e);
+                    comp.weight = comp.weight + it->lbl;
+                }
+            }
+        }
+    });
+
+    return res;
+}
+
+/// \brief Finds a minimum spanning forest of the given graph \a g grouped by
+/// connected components; components are processed in parallel on the \a pool.
+///
+/// Only labeled edges are considered, so vertices connected by unlabeled edges
+/// only are in different components. Every vertex belongs to exactly one
+/// component; isolated vertices make components without edges.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::vector<ForestComponent<Vertex, EdgeLbl> >
+findSpanningForest(const EdgeLblUGraph<Vertex, EdgeLbl>& g, WorkStealingPool& pool)
+{
+    const VertexIndex<Vertex> index(g);
+    std::vector<IdEdge<EdgeLbl> > edges = makeIdEdges(g, index);
+
+    return findSpanningForestOnEdges<Vertex, TWeightTraits>(index, index.getSize(), edges, pool);
+}
+
+/// Finds a minimum spanning forest of the given graph \a g grouped by
+/// connected components using a new pool of \a threadsNum threads (0 means
+/// the number of hardware threads).
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::vector<ForestComponent<Vertex, EdgeLbl> >
+findSpanningForest(const EdgeLblUGraph<Vertex, EdgeLbl>& g, std::size_t threadsNum = 0)
+{
+    WorkStealingPool pool(threadsNum);
+    return findSpanningForest<Vertex, EdgeLbl, TWeightTraits>(g, pool);
+}
+
+/// Finds a minimum spanning forest of the given snapshot \a g grouped by
+/// connected components on the \a pool.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::vector<ForestComponent<Vertex, EdgeLbl> >
+findSpanningForest(const CsrSnapshot<Vertex, EdgeLbl>& g, WorkStealingPool& pool)
+{
+    std::vector<IdEdge<EdgeLbl> > edges = makeIdEdges(g);
+
+    return findSpanningForestOnEdges<Vertex, TWeightTraits>(g, g.getVerticesNum(), edges, pool);
+}
+
+/// Finds a minimum spanning forest of the given snapshot \a g grouped by
+/// connected components using a new pool of \a threadsNum threads.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::vector<ForestComponent<Vertex, EdgeLbl> >
+findSpanningForest(const CsrSnapshot<Vertex, EdgeLbl>& g, std::size_t threadsNum = 0)
+{
+    WorkStealingPool pool(threadsNum);
+    return findSpanningForest<Vertex, EdgeLbl, TWeightTraits>(g, pool);
+}
+
+
+
+#endif // SPANNING_FOREST_HPP
@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a one-pass MST algorithm for streams of labeled edges
+///             that keeps O(V) memory.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef STREAMING_MST_HPP
+#define STREAMING_MST_HPP
+
+#include <map>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#include <tuple>
+#include <cstdint>
+#include <cstddef>
+
+#include "link_cut_tree.hpp"
+#include "ugraph_algos.hpp"
+
+
+
+/// \brief Reads edges from the text stream \a in where they are given as
+/// triples "s d label" separated by whitespace and calls f(s, d, lbl) for
+/// every one in order.
+///
+/// \throws std::invalid_argument if the stream ends in the middle of a triple
+/// or a value can't be read.
+template <typename Vertex, typename EdgeLbl, typename TEdgeFunc>
+void readEdgeTriples(std::istream& in, TEdgeFunc f)
+{
+    Vertex s, d;
+    EdgeLbl lbl;
+    while (in >> s)
+    {
+        if (!(in >> d >> lbl))
+            throw std::invalid_argument("Malformed edge in a stream");
+        f(s, d, lbl);
+    }
+
+    if (!in.eof())
+        throw std::invalid_argument("Malformed edge in a stream");
+}
+
+
+/*! ****************************************************************************
+ *  \brief The StreamingMST class finds a minimum spanning forest of a graph
+ *  given by a stream of labeled edges in one pass, keeping only a candidate
+ *  forest in memory.
+ *
+ *  The candidate forest is kept in a link-cut tree (see DynamicMST). An edge
+ *  {u, v} from the stream links two trees or, if it closes a cycle, the
+ *  heaviest edge of the cycle is evicted (it may be the new one); an evicted
+ *  edge is never in the MST, so it is forgotten. Every edge takes O(log V)
+ *  amortized time, and memory is O(V): about 100 bytes per vertex with int
+ *  vertices and labels, independently of the number of edges.
+ *
+ *  An edge may appear in the stream several times with different labels; all
+ *  of them are treated as parallel edges, so the lightest one counts. Self-loops
+ *  are skipped.
+ *
+ *  \tparam Vertex represents a type for vertices.
+ *  \tparam EdgeLbl represents a type for edge labels.
+ *  \tparam TWeightTraits describes labels as weights (see WeightTraits).
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+class StreamingMST {
+public:
+    // type definitions
+    typedef LinkCutTree<EdgeLbl, typename TWeightTraits::Compare> Forest;
+    typedef typename Forest::Node Node;
+
+public:
+    /// Creates an empty forest.
+    StreamingMST()
+        : _edgesNum(0)
+        , _streamedNum(0)
+    {
+    }
+
+public:
+    // Stream consuming methods.
+
+    /// Takes the next edge {s, d} labeled \a lbl from the stream.
+    void addEdge(const Vertex& s, const Vertex& d, const EdgeLbl& lbl)
+    {
+        ++_streamedNum;
+        if (!(s < d) && !(d < s))
+            return;                                 // self-loops never get into a MST
+
+        const Node u = getNode(s);
+        const Node v = getNode(d);
+        const Node heaviest = _forest.findPathMax(u, v);
+        if (heaviest != Forest::NoNode)
+        {
+            if (!_less(lbl, _forest.getKey(heaviest)))
+                return;                             // the new edge is evicted
+
+            const std::pair<Node, Node> ends = _endsOfNode[heaviest];
+            _forest.cut(heaviest, ends.first);
+            _forest.cut(heaviest, ends.second);
+            _forest.removeNode(heaviest);
+            --_edgesNum;
+        }
+
+        Node en = _forest.addNode(lbl);
+        _forest.link(en, u);
+        _forest.link(en, v);
+        if (en >= _endsOfNode.size())
+            _endsOfNode.resize(en + 1, std::make_pair(Forest::NoNode, Forest::NoNode));
+        _endsOfNode[en] = std::make_pair(u, v);
+        ++_edgesNum;
+    }
+
+    /// Takes edges from the range [\a first, \a last) of tuples {s, d, label}
+    /// (e.g., EdgeLblUGraph::LblEdgeTuple).
+    template <typename InputIt>
+    void addEdges(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            addEdge(std::get<0>(*first), std::get<1>(*first), std::get<2>(*first));
+    }
+
+    /// \brief Takes all the edges from the text stream \a in where they are
+    /// given as triples "s d label" separated by whitespace.
+    ///
+    /// \throws std::invalid_argument if the stream ends in the middle of a
+    /// triple or a value can't be read.
+    void readEdges(std::istream& in)
+    {
+        readEdgeTriples<Vertex, EdgeLbl>(in, [this](const Vertex& s, const Vertex& d,
+                                                     const EdgeLbl& lbl)
+        {
+            addEdge(s, d, lbl);
+        });
+    }
+
+public:
+    // setters/getters
+
+    /// Returns the number of edges taken from the stream so far.
+    std::uint64_t getStreamedNum() const { return _streamedNum; }
+
+    /// Returns the number of vertices seen so far (except for those having
+    /// self-loops only).
+    std::size_t getVerticesNum() const { return _vertexNodes.size(); }
+
+    /// Returns the number of edges of the current forest.
+    std::size_t getEdgesNum() const { return _edgesNum; }
+
+    /// Calls f(u, v, lbl) for every edge {u, v} of the current forest, which
+    /// is the MST of the edges taken so far; u < v, edges are not ordered.
+    template <typename TEdgeFunc>
+    void forEachEdge(TEdgeFunc f) const
+    {
+        for (Node en = 0; en < _endsOfNode.size(); ++en)
+        {
+            const std::pair<Node, Node>& ends = _endsOfNode[en];
+            if (ends.first == Forest::NoNode || !_forest.hasKey(en))
+                continue;
+
+            const Vertex& u = _vertexOfNode[ends.first];
+            const Vertex& v = _vertexOfNode[ends.second];
+            if (u < v)
+                f(u, v, _forest.getKey(en));
+            else
+                f(v, u, _forest.getKey(en));
+        }
+    }
+
+    /// Returns the edges of the current forest with their total weight.
+    MSTEdges<Vertex, EdgeLbl> getMSTEdges() const
+    {
+        MSTEdges<Vertex, EdgeLbl> res;
+        res.weight = TWeightTraits::zero();
+        res.edges.reserve(_edgesNum);
+        forEachEdge([&res](const Vertex& u, const Vertex& v, const EdgeLbl& lbl)
+        {
+            LblEdge<Vertex, EdgeLbl> e = {u, v, lbl};
+            res.edges.push_back(e);
+            res.weight = res.weight + lbl;
+        });
+
+        return res;
+    }
+
+protected:
+    /// Returns the node of the vertex \a v making it if it is not there.
+    Node getNode(const Vertex& v)
+    {
+        typename std::map<Vertex, Node>::iterator it = _vertexNodes.lower_bound(v);
+        if (it == _vertexNodes.end() || v < it->first)
+        {
+            it = _vertexNodes.insert(it, std::make_pair(v, _forest.addNode()));
+            if (it->second >= _vertexOfNode.size())
+                _vertexOfNode.resize(it->second + 1);
+            _vertexOfNode[it->second] = v;
+        }
+
+        return it->second;
+    }
+
+protected:
+    Forest _forest;                                 ///< Candidate forest.
+    std::map<Vertex, Node> _vertexNodes;            ///< Nodes of vertices.
+    std::vector<Vertex> _vertexOfNode;              ///< Vertices of vertex nodes.
+    std::vector<std::pair<Node, Node> > _endsOfNode;    ///< Ends of edge nodes.
+    std::size_t _edgesNum;                          ///< Edges in the forest.
+    std::uint64_t _streamedNum;                     ///< Edges taken.
+    typename TWeightTraits::Compare _less;          ///< Ordering of weights.
+}; // class StreamingMST
+
+
+/// \brief Finds a MST of the graph given by the text stream \a in of triples
+/// "s d label" in one pass and O(V) memory (see StreamingMST).
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+MSTEdges<Vertex, EdgeLbl> findMSTStream(std::istream& in)
+{
+    StreamingMST<Vertex, EdgeLbl, TWeightTraits> mst;
+    mst.readEdges(in);
+
+    return mst.getMSTEdges();
+}
+
+/// Finds a MST of the graph given by the text file with the name \a fn of
+/// triples "s d label" in one pass and O(V) memory.
+template <typename Vertex, typename EdgeLbl,
+          typename TWeightTraits = WeightTraits<EdgeLbl> >
+MSTEdges<Vertex, EdgeLbl> findMSTStream(const std::string& fn)
+{
+    std::ifstream f(fn.c_str());
+    if (!f.is_open())
+        throw std::invalid_argument("Can't open an edge stream file");
+
+    return findMSTStream<Vertex, EdgeLbl, TWeightTraits>(f);
+}
+
+
+
+#endif // STREAMING_MST_HPP
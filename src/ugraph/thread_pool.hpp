@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a work-stealing thread pool used by the parallel graph
+///             algorithms.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <cstddef>
+
+
+
+/*! ****************************************************************************
+ *  \brief The WorkStealingPool class represents a fixed set of worker threads
+ *  executing tasks.
+ *
+ *  Every worker owns a deque of tasks: it takes tasks from the back of its own
+ *  deque and, when it is empty, steals from the front of the others. Tasks
+ *  submitted by a worker go to its own deque, tasks submitted by other threads
+ *  are distributed round-robin. A thread waiting for parallelFor() to finish
+ *  executes tasks too, so parallelFor() can be nested.
+ ******************************************************************************/
+class WorkStealingPool {
+public:
+    /// Task to execute.
+    typedef std::function<void()> Task;
+
+public:
+    /// Starts \a threadsNum workers; 0 means the number of hardware threads.
+    explicit WorkStealingPool(std::size_t threadsNum = 0)
+        : _pending(0)
+        , _nextQueue(0)
+        , _stop(false)
+    {
+        if (threadsNum == 0)
+            threadsNum = std::thread::hardware_concurrency();
+        if (threadsNum == 0)
+            threadsNum = 1;
+
+        for (std::size_t i = 0; i < threadsNum; ++i)
+            _queues.emplace_back(new Queue());
+        for (std::size_t i = 0; i < threadsNum; ++i)
+            _threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+
+    /// Finishes all the submitted tasks and stops the workers.
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lk(_sleepMutex);
+            _stop = true;
+        }
+        _wakeUp.notify_all();
+
+        for (std::thread& t : _threads)
+            t.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+public:
+    // setters/getters
+    std::size_t getThreadsNum() const { return _threads.size(); }
+
+public:
+    /// Puts the task \a t in a queue.
+    void submit(Task t)
+    {
+        WorkerInfo& me = currentWorker();
+        std::size_t q = (me.pool == this)
+            ? me.index
+            : _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+
+        {
+            std::lock_guard<std::mutex> lk(_queues[q]->mutex);
+            _queues[q]->tasks.push_back(std::move(t));
+        }
+        _pending.fetch_add(1, std::memory_order_release);
+
+        // the lock prevents a worker that is going to sleep from missing it
+        {
+            std::lock_guard<std::mutex> lk(_sleepMutex);
+        }
+        _wakeUp.notify_one();
+    }
+
+    /// \brief Splits [\a begin, \a end) into chunks of \a grain elements and
+    /// calls f(from, to) for every chunk in parallel. Returns when all the
+    /// calls are finished.
+    ///
+    /// If some call throws, the first exception is rethrown.
+    template <typename F>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, F f)
+    {
+        if (begin >= end)
+            return;
+        if (grain == 0)
+            grain = 1;
+
+        std::atomic<std::size_t> left((end - begin + grain - 1) / grain);
+        std::exception_ptr error;
+        std::mutex errorMutex;
+
+        for (std::size_t from = begin; from < end; from += grain)
+        {
+            std::size_t to = (end - from > grain) ? from + grain : end;
+            submit([&, from, to]()
+            {
+                try
+                {
+                    f(from, to);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lk(errorMutex);
+                    if (!error)
+                        error = std::current_exception();
+                }
+                left.fetch_sub(1, std::memory_order_acq_rel);
+            });
+        }
+
+        // helps the workers instead of blocking
+        while (left.load(std::memory_order_acquire) != 0)
+        {
+            if (!runPendingTask())
+                std::this_thread::yield();
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    /// Suggests a chunk size for processing \a n elements by parallelFor():
+    /// a few chunks per worker, but not smaller than \a minGrain.
+    std::size_t suggestGrain(std::size_t n, std::size_t minGrain = 1024) const
+    {
+        std::size_t grain = n / (getThreadsNum() * 4) + 1;
+        return grain < minGrain ? minGrain : grain;
+    }
+
+protected:
+    /// Deque of tasks of a worker.
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    /// Identifies the pool and the worker the current thread belongs to.
+    struct WorkerInfo {
+        WorkStealingPool* pool;
+        std::size_t index;
+    };
+
+    static WorkerInfo& currentWorker()
+    {
+        thread_local WorkerInfo info = {nullptr, 0};
+        return info;
+    }
+
+    /// Takes a task from the own deque of the current worker (if it is one)
+    /// or steals it from another deque and executes it.
+    ///
+    /// \return false if no task has been found.
+    bool runPendingTask()
+    {
+        if (_pending.load(std::memory_order_acquire) == 0)
+            return false;
+
+        WorkerInfo& me = currentWorker();
+        std::size_t self = (me.pool == this) ? me.index : 0;
+        Task t;
+
+        if (me.pool == this && popBack(self, t))
+        {
+            t();
+            return true;
+        }
+
+        for (std::size_t i = 0; i < _queues.size(); ++i)
+        {
+            std::size_t victim = (self + 1 + i) % _queues.size();
+            if (popFront(victim, t))
+            {
+                t();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool popBack(std::size_t q, Task& t)
+    {
+        std::lock_guard<std::mutex> lk(_queues[q]->mutex);
+        if (_queues[q]->tasks.empty())
+            return false;
+
+        t = std::move(_queues[q]->tasks.back());
+        _queues[q]->tasks.pop_back();
+        _pending.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool popFront(std::size_t q, Task& t)
+    {
+        std::lock_guard<std::mutex> lk(_queues[q]->mutex);
+        if (_queues[q]->tasks.empty())
+            return false;
+
+        t = std::move(_queues[q]->tasks.front());
+        _queues[q]->tasks.pop_front();
+        _pending.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// Main loop of the worker with the index \a index.
+    void workerLoop(std::size_t index)
+    {
+        WorkerInfo& me = currentWorker();
+        me.pool = this;
+        me.index = index;
+
+        for (;;)
+        {
+            if (runPendingTask())
+                continue;
+
+            std::unique_lock<std::mutex> lk(_sleepMutex);
+            _wakeUp.wait(lk, [this]()
+            {
+                return _stop || _pending.load(std::memory_order_acquire) != 0;
+            });
+
+            if (_stop && _pending.load(std::memory_order_acquire) == 0)
+                return;
+        }
+    }
+
+protected:
+    std::vector<std::unique_ptr<Queue> > _queues;   ///< Deques of workers.
+    std::vector<std::thread> _threads;              ///< Workers.
+    std::atomic<std::size_t> _pending;              ///< Number of queued tasks.
+    std::atomic<std::size_t> _nextQueue;            ///< For round-robin.
+    std::mutex _sleepMutex;                         ///< Guards sleeping.
+    std::condition_variable _wakeUp;                ///< Wakes idle workers.
+    bool _stop;                                     ///< Workers must stop.
+}; // class WorkStealingPool
+
+
+
+#endif // THREAD_POOL_HPP
@@ -20,6 +20,9 @@
 
 #include <set>
 #include <map>
+#include <vector>
+#include <iterator>
+#include <algorithm>
 //#include <cstddef> // size_t
 
 
@@ -220,6 +223,42 @@ public:
         return e;
     }
 
+    /// \brief Adds into this graph all the edges from the range [\a first,
+    /// \a last) of pairs of vertices.
+    ///
+    /// The result is the same as of calling addEdge() for every pair, but
+    /// edges are sorted and deduplicated first and then put into the
+    /// containers in one pass, so the adjacency of every vertex is scanned
+    /// at most once.
+    template <typename InputIt>
+    void addEdges(InputIt first, InputIt last)
+    {
+        std::vector<Edge> edges;
+        for (; first != last; ++first)
+            edges.push_back(makeNormalizedEdge(first->first, first->second));
+
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        addSortedEdges(edges);
+    }
+
+    /// \brief Removes the edge {s, d} (or equivalent {d, s}) from this graph;
+    /// its vertices stay in the graph.
+    /// \return true if the edge has been removed, false if there was no such
+    /// edge.
+    ///
+    /// The method is virtual, so that a graph keeping data of edges (see
+    /// EdgeLblUGraph) drops them even if an edge is removed through a
+    /// reference to UGraph.
+    virtual bool removeEdge(Vertex s, Vertex d)
+    {
+        if (!removeHalfEdge(s, d))
+            return false;
+
+        removeHalfEdge(d, s);                   // a self-loop has two halves too
+        return true;
+    }
+
     /// Method determines whether an edge {s, d} exists in this graph.
     ///
     /// \return true if the edge exists, false otherwise.
@@ -274,6 +313,72 @@ public:
     }
 
 
+protected:
+    /// Removes one entry d from the adjacency list of s if it is there.
+    bool removeHalfEdge(const Vertex& s, const Vertex& d)
+    {
+        std::pair<AdjListIter, AdjListIter> range = _edges.equal_range(s);
+        for (AdjListIter it = range.first; it != range.second; ++it)
+        {
+            if (it->second == d)
+            {
+                _edges.erase(it);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// Adds into this graph normalized, sorted and unique \a edges; edges
+    /// that already exist are skipped.
+    void addSortedEdges(const std::vector<Edge>& edges)
+    {
+        // vertices go in ascending order, so hints make insertions O(1)
+        std::vector<Vertex> vs;
+        vs.reserve(edges.size() * 2);
+        for (const Edge& e : edges)
+        {
+            vs.push_back(e.first);
+            vs.push_back(e.second);
+        }
+        std::sort(vs.begin(), vs.end());
+        vs.erase(std::unique(vs.begin(), vs.end()), vs.end());
+
+        VertexIter vHint = _vertices.begin();
+        for (const Vertex& v : vs)
+            vHint = std::next(_vertices.insert(vHint, v));
+
+        // new halves of edges; edges of the same vertex s are checked against
+        // its current neighbours at once
+        std::vector<Edge> halves;
+        halves.reserve(edges.size() * 2);
+        std::vector<Vertex> nbrs;
+        for (std::size_t i = 0; i < edges.size(); )
+        {
+            const Vertex& s = edges[i].first;
+            nbrs.clear();
+            AdjListCIterPair adj = getAdjEdges(s);
+            for (AdjListCIter it = adj.first; it != adj.second; ++it)
+                nbrs.push_back(it->second);
+            std::sort(nbrs.begin(), nbrs.end());
+
+            for (; i < edges.size() && edges[i].first == s; ++i)
+            {
+                if (std::binary_search(nbrs.begin(), nbrs.end(), edges[i].second))
+                    continue;
+
+                halves.push_back(edges[i]);
+                halves.push_back(Edge(edges[i].second, edges[i].first));
+            }
+        }
+
+        std::sort(halves.begin(), halves.end());
+        AdjListIter eHint = _edges.begin();
+        for (const Edge& h : halves)
+            eHint = std::next(_edges.insert(eHint, h));
+    }
+
 protected:
     VerticesSet _vertices;      ///< Set of vertices.
     AdjList _edges;             ///< Adjacency list for representing edges.
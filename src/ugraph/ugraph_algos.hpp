@@ -19,108 +19,914 @@
 
 #include <set>
 #include <map>
+#include <vector>
 #include <algorithm>
+#include <iterator>
+#include <utility>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <cstdint>
 
 #include "lbl_ugraph.hpp"
+#include "vertex_index.hpp"
+#include "indexed_heap.hpp"
+#include "disjoint_set.hpp"
+#include "thread_pool.hpp"
+#include "weight_traits.hpp"
+#include "simd_argmin.hpp"
 
+
+/// Arity of the heaps used as priority queues by the algorithms below; can be
+/// redefined at compile time.
+#ifndef UGRAPH_HEAP_ARITY
+#define UGRAPH_HEAP_ARITY 4
+#endif
+
+/// Density of a graph (the ratio of E to V (V - 1) / 2) starting from which
+/// findMSTPrim() uses an adjacency matrix instead of a heap; can be redefined
+/// at compile time. findMST() (see mst_dispatch.hpp) uses calibrated densities
+/// instead.
+#ifndef UGRAPH_DENSE_PRIM_DENSITY
+#define UGRAPH_DENSE_PRIM_DENSITY 0.25
+#endif
+
+
+/// Labeled edge {s, d} of a result of an algorithm; s is not greater than d.
 template<typename Vertex, typename EdgeLbl>
-class PriorityQueue
+struct LblEdge
+{
+    Vertex s;
+    Vertex d;
+    EdgeLbl lbl;
+};
+
+
+/// Puts normalized edges of a forest given by an array of \a parents of
+/// vertices with dense ids into the container \a res (a set or a vector); a
+/// root is a parent of itself. \a vertices is a VertexIndex or a CsrSnapshot
+/// the ids are taken from.
+template<typename TVertexTable, typename TContainer>
+void makeEdgesFromParents(const TVertexTable& vertices, const std::vector<VertexId>& parents,
+                          TContainer& res)
 {
+    for (VertexId v = 0; v < parents.size(); ++v)
+    {
+        if (parents[v] == v)
+            continue;
+
+        // ids are ordered as vertices are, so this gives a normalized edge
+        VertexId s = std::min(v, parents[v]);
+        VertexId d = std::max(v, parents[v]);
+        res.insert(res.end(), std::make_pair(vertices.getVertex(s), vertices.getVertex(d)));
+    }
+}
+
+/// Makes a set of normalized edges of a forest given by an array of \a parents
+/// of vertices with dense ids.
+template<typename Vertex, typename TVertexTable>
+std::set<std::pair<Vertex, Vertex> >
+makeEdgesFromParents(const TVertexTable& vertices, const std::vector<VertexId>& parents)
+{
+    std::set<std::pair<Vertex, Vertex> > res;
+    makeEdgesFromParents(vertices, parents, res);
+
+    return res;
+}
+
+
+/*! ****************************************************************************
+ *  \brief The MSTWorkspace class keeps the state of Prim's algorithm between
+ *  calls: the vertex index, the adjacency of a graph by ids, the queue, the
+ *  visited flags and the parents.
+ *
+ *  Arrays only grow, so once a workspace has seen the largest graph, further
+ *  calls of findMSTPrimHeap() with it (and with a reused vector
+ *  for the result) do not allocate memory. A workspace must not be shared by
+ *  threads running at the same time.
+ *
+ *  \tparam Vertex represents a type for vertices.
+ *  \tparam EdgeLbl represents a type for edge labels.
+ *  \tparam TWeightTraits describes labels as weights (see WeightTraits).
+ ******************************************************************************/
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+class MSTWorkspace {
+public:
+    // type definitions
+    typedef IndexedDaryHeap<EdgeLbl, UGRAPH_HEAP_ARITY,
+                            typename TWeightTraits::Compare> Queue;
+
 public:
-    void insert(const Vertex& u, const EdgeLbl& v)
+    /// Creates an empty workspace; memory is allocated by the first call.
+    MSTWorkspace() {}
+
+    /// Prepares the arrays for a graph with \a n vertices: every vertex is
+    /// unvisited and is a root. Reallocates memory only if \a n grows.
+    void reset(std::size_t n)
     {
-        _getAccessByV.insert(std::make_pair(u, v));
-        _getAccessByL.insert(std::make_pair(v, u));
+        _queue.reset(n);
+        _visited.assign(n, 0);
+        _parents.resize(n);
+        for (VertexId v = 0; v < n; ++v)
+            _parents[v] = v;
     }
 
-    void remove(const Vertex& u)
+public:
+    // setters/getters
+    VertexIndex<Vertex>& getIndex() { return _index; }
+    Queue& getQueue() { return _queue; }
+    std::vector<char>& getVisited() { return _visited; }
+    std::vector<VertexId>& getParents() { return _parents; }
+    std::vector<std::size_t>& getAdjOffsets() { return _adjOffsets; }
+    std::vector<VertexId>& getAdjIds() { return _adjIds; }
+    std::vector<EdgeLbl>& getAdjLbls() { return _adjLbls; }
+
+protected:
+    VertexIndex<Vertex> _index;         ///< Dense ids of vertices of a graph.
+    std::vector<std::size_t> _adjOffsets;   ///< Ranges of vertices in _adjIds.
+    std::vector<VertexId> _adjIds;      ///< Ids of neighbours of a graph.
+    std::vector<EdgeLbl> _adjLbls;      ///< Labels of edges to neighbours.
+    Queue _queue;                       ///< Reachable vertices not visited yet.
+    std::vector<char> _visited;         ///< Vertices visited.
+    std::vector<VertexId> _parents;     ///< Result MST as a forest.
+}; // class MSTWorkspace
+
+
+/// Callback of findMSTPrimOnHeap() that ignores edges.
+struct IgnoreMSTEdge
+{
+    template<typename EdgeLbl>
+    void operator()(VertexId, VertexId, const EdgeLbl&) const {}
+};
+
+/// Finds a minimum spanning forest of a graph with \a n vertices using Prim's
+/// algorithm with the heap of the workspace \a ws; the result is left in
+/// ws.getParents(). forEachAdj(u, f) must call f(v, lbl) for every labeled
+/// edge {u, v} of the graph. onEdge(v, parent, lbl) is called for an edge of
+/// the MST as soon as its vertex v is visited, i.e. the edge is final.
+template<typename TWeightTraits, typename TWorkspace, typename TAdjFunc,
+         typename TEdgeFunc = IgnoreMSTEdge>
+void findMSTPrimOnHeap(std::size_t n, TWorkspace& ws, TAdjFunc forEachAdj,
+                       TEdgeFunc onEdge = TEdgeFunc())
+{
+    ws.reset(n);
+    typename TWorkspace::Queue& unvisited = ws.getQueue();
+    std::vector<char>& visited = ws.getVisited();
+    std::vector<VertexId>& parents = ws.getParents();
+
+    for (VertexId start = 0; start < n; ++start)
     {
-        auto it = _getAccessByV.find(u);
-        auto it2 = _getAccessByL.find(std::make_pair(it->second, u));
-        if (it != _getAccessByV.end())
+        if (visited[start])
+            continue;
+
+        // a new tree of the forest starts here; its root's cost doesn't matter
+        unvisited.insert(start, TWeightTraits::zero());
+        while (!unvisited.isEmpty())
         {
-            _getAccessByV.erase(it);
-            _getAccessByL.erase(it2);
+            if (parents[unvisited.getMin()] != unvisited.getMin())
+                onEdge(unvisited.getMin(), parents[unvisited.getMin()], unvisited.getMinKey());
+
+            VertexId item = static_cast<VertexId>(unvisited.extractMin());
+            visited[item] = 1;
+
+            forEachAdj(item, [&](VertexId adjNode, const auto& lbl)
+            {
+                if (visited[adjNode])
+                    return;
+
+                if (unvisited.insertOrDecrease(adjNode, lbl))
+                    parents[adjNode] = item;
+            });
         }
     }
+}
+
+/// Runs findMSTPrimOnHeap() for the given graph \a g; the result is left in
+/// ws.getParents() with ids given by ws.getIndex().
+template<typename Vertex, typename EdgeLbl, typename TWeightTraits,
+         typename TEdgeFunc = IgnoreMSTEdge>
+void findMSTPrimHeapParents(const EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                            MSTWorkspace<Vertex, EdgeLbl, TWeightTraits>& ws,
+                            TEdgeFunc onEdge = TEdgeFunc())
+{
+    typedef EdgeLblUGraph<Vertex, EdgeLbl> Graph;
 
-    void set(const Vertex&u, const EdgeLbl& newLbl)
+    VertexIndex<Vertex>& index = ws.getIndex();
+    index.reset(g);
+
+    // ids of neighbours are resolved once into flat arrays of the workspace,
+    // so the loop of Prim's algorithm reads them as it does for a snapshot;
+    // labels are kept in adjacency entries, no lookups are needed for them
+    std::vector<std::size_t>& offsets = ws.getAdjOffsets();
+    std::vector<VertexId>& ids = ws.getAdjIds();
+    std::vector<EdgeLbl>& lbls = ws.getAdjLbls();
+    offsets.clear();
+    ids.clear();
+    lbls.clear();
+    offsets.push_back(0);
+    for (VertexId u = 0; u < index.getSize(); ++u)
     {
-        remove(u);
-        insert(u, newLbl);
+        typename Graph::LblAdjListCIterPair range = g.getLblAdjEdges(index.getVertex(u));
+        for (typename Graph::LblAdjListCIter it = range.first; it != range.second; ++it)
+        {
+            ids.push_back(index.getId(it->second.vertex));
+            lbls.push_back(it->second.lbl);
+        }
+        offsets.push_back(ids.size());
     }
 
-    Vertex getMin() const
+    findMSTPrimOnHeap<TWeightTraits>(index.getSize(), ws, [&](VertexId u, auto f)
     {
-        return _getAccessByL.begin()->second;
-    }
+        for (std::size_t j = offsets[u]; j < offsets[u + 1]; ++j)
+            f(ids[j], lbls[j]);
+    }, onEdge);
+}
+
+/// Runs findMSTPrimOnHeap() for the given snapshot \a g; the result is left in
+/// ws.getParents().
+template<typename Vertex, typename EdgeLbl, typename TWeightTraits,
+         typename TEdgeFunc = IgnoreMSTEdge>
+void findMSTPrimHeapParents(const CsrSnapshot<Vertex, EdgeLbl>& g,
+                            MSTWorkspace<Vertex, EdgeLbl, TWeightTraits>& ws,
+                            TEdgeFunc onEdge = TEdgeFunc())
+{
+    typedef CsrSnapshot<Vertex, EdgeLbl> Graph;
+
+    findMSTPrimOnHeap<TWeightTraits>(g.getVerticesNum(), ws, [&](VertexId u, auto f)
+    {
+        typename Graph::AdjCIterPair range = g.getAdjEdges(u);
+        for (typename Graph::AdjCIter it = range.first; it != range.second; ++it)
+        {
+            if (it->hasLbl)
+                f(it->vertex, it->lbl);
+        }
+    }, onEdge);
+}
+
+/// \brief Finds a MST for the given graph \a g using Prim's algorithm with a
+/// heap and the workspace \a ws; the normalized edges of the MST are put into
+/// \a res in ascending order.
+///
+/// \a res is cleared first, and its capacity is reused, so repeated calls with
+/// the same workspace and vector do not allocate memory once they have seen
+/// the largest graph.
+template<typename Vertex, typename EdgeLbl, typename TWeightTraits>
+void findMSTPrimHeap(const EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                     MSTWorkspace<Vertex, EdgeLbl, TWeightTraits>& ws,
+                     std::vector<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>& res)
+{
+    findMSTPrimHeapParents(g, ws);
+    res.clear();
+    makeEdgesFromParents(ws.getIndex(), ws.getParents(), res);
+    std::sort(res.begin(), res.end());
+}
+
+/// Finds a MST for the given snapshot \a g using Prim's algorithm with a heap
+/// and the workspace \a ws; see the overload for EdgeLblUGraph.
+template<typename Vertex, typename EdgeLbl, typename TWeightTraits>
+void findMSTPrimHeap(const CsrSnapshot<Vertex, EdgeLbl>& g,
+                     MSTWorkspace<Vertex, EdgeLbl, TWeightTraits>& ws,
+                     std::vector<typename CsrSnapshot<Vertex, EdgeLbl>::Edge>& res)
+{
+    findMSTPrimHeapParents(g, ws);
+    res.clear();
+    makeEdgesFromParents(g, ws.getParents(), res);
+    std::sort(res.begin(), res.end());
+}
+
+/// Finds a MST for the given graph \a g using Prim's algorithm with a heap;
+/// takes O(E log V) time.
+///
+/// Only labeled edges are considered. If the graph is disconnected, a minimum
+/// spanning forest is returned. Edges of the result are normalized (see
+/// UGraph::makeNormalizedEdge()). Labels are compared as weights described by
+/// \a TWeightTraits (see WeightTraits); the same holds for all the algorithms
+/// below.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>
+findMSTPrimHeap(const EdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    MSTWorkspace<Vertex, EdgeLbl, TWeightTraits> ws;
+    findMSTPrimHeapParents(g, ws);
+
+    return makeEdgesFromParents<Vertex>(ws.getIndex(), ws.getParents());
+}
+
+/// Finds a MST for the given snapshot \a g using Prim's algorithm with a heap.
+///
+/// The result is the same as findMSTPrimHeap() gives for the graph the
+/// snapshot is made of.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename CsrSnapshot<Vertex, EdgeLbl>::Edge>
+findMSTPrimHeap(const CsrSnapshot<Vertex, EdgeLbl>& g)
+{
+    MSTWorkspace<Vertex, EdgeLbl, TWeightTraits> ws;
+    findMSTPrimHeapParents(g, ws);
+
+    return makeEdgesFromParents<Vertex>(g, ws.getParents());
+}
 
-    EdgeLbl getCost(const Vertex& u) const
+/// \brief Finds a MST for the given graph \a g using Prim's algorithm with a
+/// heap and the workspace \a ws, and calls f(u, v, lbl) for every its edge
+/// {u, v} as soon as the edge is final.
+///
+/// Edges are normalized (u < v) and go in the order Prim's algorithm finds
+/// them, so edges of every tree of a forest are adjacent. Nothing is
+/// collected, hence nothing is allocated once \a ws has seen the largest graph.
+template<typename Vertex, typename EdgeLbl, typename TWeightTraits, typename TEdgeFunc>
+void forEachMSTEdge(const EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                    MSTWorkspace<Vertex, EdgeLbl, TWeightTraits>& ws, TEdgeFunc f)
+{
+    const VertexIndex<Vertex>& index = ws.getIndex();
+    findMSTPrimHeapParents(g, ws, [&](VertexId v, VertexId parent, const EdgeLbl& lbl)
+    {
+        // ids are ordered as vertices are
+        if (v < parent)
+            f(index.getVertex(v), index.getVertex(parent), lbl);
+        else
+            f(index.getVertex(parent), index.getVertex(v), lbl);
+    });
+}
+
+/// Calls f(u, v, lbl) for every edge of a MST of the given snapshot \a g; see
+/// the overload for EdgeLblUGraph.
+template<typename Vertex, typename EdgeLbl, typename TWeightTraits, typename TEdgeFunc>
+void forEachMSTEdge(const CsrSnapshot<Vertex, EdgeLbl>& g,
+                    MSTWorkspace<Vertex, EdgeLbl, TWeightTraits>& ws, TEdgeFunc f)
+{
+    findMSTPrimHeapParents(g, ws, [&](VertexId v, VertexId parent, const EdgeLbl& lbl)
+    {
+        if (v < parent)
+            f(g.getVertex(v), g.getVertex(parent), lbl);
+        else
+            f(g.getVertex(parent), g.getVertex(v), lbl);
+    });
+}
+
+/// Calls f(u, v, lbl) for every edge of a MST of the given graph or snapshot
+/// \a g using a temporary workspace.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl>,
+         template<typename, typename> class TGraph, typename TEdgeFunc>
+void forEachMSTEdge(const TGraph<Vertex, EdgeLbl>& g, TEdgeFunc f)
+{
+    MSTWorkspace<Vertex, EdgeLbl, TWeightTraits> ws;
+    forEachMSTEdge(g, ws, f);
+}
+
+/// Writes every edge of a MST of the given graph or snapshot \a g to the output
+/// iterator \a out as a LblEdge (see forEachMSTEdge()); returns the iterator
+/// past the last edge written.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl>,
+         template<typename, typename> class TGraph, typename TOutputIt>
+TOutputIt findMSTEdges(const TGraph<Vertex, EdgeLbl>& g, TOutputIt out)
+{
+    forEachMSTEdge<Vertex, EdgeLbl, TWeightTraits>(g,
+        [&out](const Vertex& u, const Vertex& v, const EdgeLbl& lbl)
+        {
+            LblEdge<Vertex, EdgeLbl> e = {u, v, lbl};
+            *out++ = e;
+        });
+
+    return out;
+}
+
+/// Edges of a MST with their labels and the total weight.
+template<typename Vertex, typename EdgeLbl>
+struct MSTEdges
+{
+    std::vector<LblEdge<Vertex, EdgeLbl> > edges;   ///< In the order of findMSTEdges().
+    EdgeLbl weight;                                 ///< Sum of the labels.
+};
+
+/// Finds a MST for the given graph or snapshot \a g and returns its edges in a
+/// contiguous array together with the total weight.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl>,
+         template<typename, typename> class TGraph>
+MSTEdges<Vertex, EdgeLbl> findMSTEdges(const TGraph<Vertex, EdgeLbl>& g)
+{
+    MSTEdges<Vertex, EdgeLbl> res;
+    res.weight = TWeightTraits::zero();
+    res.edges.reserve(g.getVerticesNum());
+    forEachMSTEdge<Vertex, EdgeLbl, TWeightTraits>(g,
+        [&res](const Vertex& u, const Vertex& v, const EdgeLbl& lbl)
+        {
+            LblEdge<Vertex, EdgeLbl> e = {u, v, lbl};
+            res.edges.push_back(e);
+            res.weight = res.weight + lbl;
+        });
+
+    return res;
+}
+
+/// Adjacency matrix of a labeled graph with dense vertex ids: row-major
+/// weights of edges and a bitmap of labeled ones.
+template<typename EdgeLbl>
+struct DenseLblMatrix
+{
+    std::size_t size;                       ///< Number of vertices.
+    std::vector<EdgeLbl> weights;           ///< size * size weights.
+    std::vector<std::uint64_t> present;     ///< Which weights are labels.
+
+    DenseLblMatrix(std::size_t n, const EdgeLbl& absent)
+        : size(n)
+        , weights(n * n, absent)
+        , present((n * n + 63) / 64, 0)
     {
-        return _getAccessByV.find(u)->second;
     }
 
-    bool isEmpty()
+    bool isPresent(std::size_t pos) const
     {
-        return (_getAccessByV.empty() && _getAccessByL.empty());
+        return (present[pos >> 6] >> (pos & 63)) & 1;
     }
-private:
 
-    std::multimap<Vertex, int> _getAccessByV;
-    std::set<std::pair<int, Vertex>> _getAccessByL;
+    /// Puts a labeled edge {s, d} (except for a self-loop).
+    void setEdge(VertexId s, VertexId d, const EdgeLbl& lbl)
+    {
+        if (s == d)
+            return;
 
+        const std::size_t sd = s * size + d;
+        const std::size_t ds = d * size + s;
+        weights[sd] = weights[ds] = lbl;
+        present[sd >> 6] |= std::uint64_t(1) << (sd & 63);
+        present[ds >> 6] |= std::uint64_t(1) << (ds & 63);
+    }
+
+    /// Calls f(v, lbl) for every labeled edge {u, v}.
+    template<typename F>
+    void forEachAdj(VertexId u, F f) const
+    {
+        const std::size_t first = u * size;
+        for (VertexId v = 0; v < size; ++v)
+        {
+            if (isPresent(first + v))
+                f(v, weights[first + v]);
+        }
+    }
 };
 
-/// Finds a MST for the given graph \a g using Prim's algorithm.
-template<typename Vertex, typename EdgeLbl>
+/// Finds a minimum spanning forest of a graph with \a n vertices using Prim's
+/// algorithm with a flat array of keys instead of a heap; returns parents of
+/// vertices (roots are parents of themselves). forEachAdj(u, f) must call
+/// f(v, lbl) for every labeled edge {u, v} of the graph.
+///
+/// Every step takes the next vertex by findArgMin() over all the keys (AVX2 is
+/// used for int and float weights when available), so the algorithm takes
+/// O(V^2 + E) time and no heap operations at all.
+template<typename TWeightTraits, typename EdgeLbl, typename TAdjFunc>
+std::vector<VertexId> findMSTPrimOnArray(std::size_t n, TAdjFunc forEachAdj)
+{
+    typedef typename TWeightTraits::Compare Compare;
+    const VertexId NoId = static_cast<VertexId>(-1);
+
+    const EdgeLbl inf = TWeightTraits::infinity();
+    const Compare less = Compare();
+
+    // keys of visited and not yet reached vertices are infinities, so a vertex
+    // with a lighter key is always the next one
+    std::vector<EdgeLbl> keys(n, inf);
+    std::vector<char> reached(n, 0);
+    std::vector<char> visited(n, 0);
+    std::vector<VertexId> parents(n);
+    for (VertexId v = 0; v < n; ++v)
+        parents[v] = v;
+
+    for (std::size_t step = 0; step < n; ++step)
+    {
+        VertexId u = static_cast<VertexId>(findArgMin(keys.data(), n, less));
+        if (!less(keys[u], inf))
+        {
+            // rare case: the rest are reached by edges not lighter than
+            // infinity or are not reached at all (the next tree starts then)
+            u = NoId;
+            for (VertexId v = 0; v < n; ++v)
+            {
+                if (!visited[v] && reached[v] && (u == NoId || less(keys[v], keys[u])))
+                    u = v;
+            }
+            for (VertexId v = 0; u == NoId; ++v)
+            {
+                if (!visited[v])
+                    u = v;
+            }
+        }
+
+        visited[u] = 1;
+        keys[u] = inf;
+        forEachAdj(u, [&](VertexId v, const EdgeLbl& lbl)
+        {
+            if (visited[v])
+                return;
+
+            if (!reached[v] || less(lbl, keys[v]))
+            {
+                keys[v] = lbl;
+                parents[v] = u;
+                reached[v] = 1;
+            }
+        });
+    }
+
+    return parents;
+}
+
+/// Finds a MST for the given graph \a g using Prim's algorithm with a flat
+/// array of keys (see findMSTPrimOnArray()) over the adjacency matrix of the
+/// graph; takes O(V^2 + E log V) time and O(V^2) memory, which pays off for
+/// dense graphs.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>
+findMSTPrimDense(const EdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    typedef EdgeLblUGraph<Vertex, EdgeLbl> Graph;
+
+    const VertexIndex<Vertex> index(g);
+    DenseLblMatrix<EdgeLbl> m(index.getSize(), TWeightTraits::infinity());
+
+    // labeled edges are ordered by their first vertices, so ids of them are
+    // found by a cursor rather than by a search
+    VertexId sid = 0;
+    typename Graph::EdgeLabelingCIterPair lblEdges = g.getLblEdges();
+    for (typename Graph::EdgeLabelingCIter it = lblEdges.first; it != lblEdges.second; ++it)
+    {
+        while (index.getVertex(sid) < it->first.first)
+            ++sid;
+        m.setEdge(sid, index.getId(it->first.second), it->second);
+    }
+
+    std::vector<VertexId> parents = findMSTPrimOnArray<TWeightTraits, EdgeLbl>(
+        m.size, [&m](VertexId u, auto relax)
+        {
+            m.forEachAdj(u, relax);
+        });
+
+    return makeEdgesFromParents<Vertex>(index, parents);
+}
+
+/// Finds a MST for the given snapshot \a g using Prim's algorithm with a flat
+/// array of keys. The adjacency of the snapshot is used directly, so it takes
+/// O(V^2 + E) time and O(V) extra memory.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename CsrSnapshot<Vertex, EdgeLbl>::Edge>
+findMSTPrimDense(const CsrSnapshot<Vertex, EdgeLbl>& g)
+{
+    typedef CsrSnapshot<Vertex, EdgeLbl> Graph;
+
+    std::vector<VertexId> parents = findMSTPrimOnArray<TWeightTraits, EdgeLbl>(
+        g.getVerticesNum(), [&g](VertexId u, auto relax)
+        {
+            typename Graph::AdjCIterPair range = g.getAdjEdges(u);
+            for (typename Graph::AdjCIter it = range.first; it != range.second; ++it)
+            {
+                if (it->hasLbl)
+                    relax(it->vertex, it->lbl);
+            }
+        });
+
+    return makeEdgesFromParents<Vertex>(g, parents);
+}
+
+/// Determines whether a graph with \a verticesNum vertices and \a edgesNum
+/// edges has a density of at least \a minDensity, i.e.
+/// E >= minDensity * V (V - 1) / 2; a density greater than 1 means "never".
+inline bool isDenseGraph(std::size_t verticesNum, std::size_t edgesNum,
+                         double minDensity = UGRAPH_DENSE_PRIM_DENSITY)
+{
+    const double pairs = 0.5 * verticesNum * (verticesNum - 1.0);
+    return verticesNum > 1 && edgesNum >= minDensity * pairs;
+}
+
+/// \brief Finds a MST for the given graph \a g using Prim's algorithm:
+/// findMSTPrimDense() is used for dense graphs (see isDenseGraph()) and
+/// findMSTPrimHeap() for the others.
+///
+/// A graph and its snapshot are always dense or not both, so they give the
+/// same MST even if there are several ones.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
 std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>
 findMSTPrim(const EdgeLblUGraph<Vertex, EdgeLbl>& g)
 {
-    std::map<Vertex, Vertex> MST;                                                       //result MST
-    typename std::map<Vertex, Vertex>::iterator MSTit;                                  //it for MST
-    std::set<Vertex> VisitedNodes;                                                      //Nodes we have visited
-    PriorityQueue<Vertex, EdgeLbl> UnvisitedNodes;                                      //Nodes we haven't visited yet
-    typename EdgeLblUGraph<Vertex, EdgeLbl>::VertexIterPair Vertices = g.getVertices(); // the array of vertices represented by a pair of iterators
-    std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge> res;
-    UnvisitedNodes.insert(*Vertices.first, 0);                                          // we are choosing first element from set of vertices
-    
-    for (auto it = ++Vertices.first; it != Vertices.second; ++it)
-    {
-        UnvisitedNodes.insert(*it, INT_MAX);                                            // filling up the PQ with infinities
+    if (isDenseGraph(g.getVerticesNum(), g.getEdgesNum()))
+        return findMSTPrimDense<Vertex, EdgeLbl, TWeightTraits>(g);
+
+    return findMSTPrimHeap<Vertex, EdgeLbl, TWeightTraits>(g);
+}
+
+/// Finds a MST for the given snapshot \a g using Prim's algorithm; the
+/// variant is chosen in the same way as for a graph.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename CsrSnapshot<Vertex, EdgeLbl>::Edge>
+findMSTPrim(const CsrSnapshot<Vertex, EdgeLbl>& g)
+{
+    if (isDenseGraph(g.getVerticesNum(), g.getEdgesNum()))
+        return findMSTPrimDense<Vertex, EdgeLbl, TWeightTraits>(g);
+
+    return findMSTPrimHeap<Vertex, EdgeLbl, TWeightTraits>(g);
+}
+
+/// Labeled edge {s, d} of a graph with dense vertex ids; used by the
+/// algorithms working on flat arrays of edges.
+template<typename EdgeLbl>
+struct IdEdge
+{
+    VertexId s;
+    VertexId d;
+    EdgeLbl lbl;
+};
+
+/// Sorts the labeled edges [\a first, \a last) in the order Kruskal's
+/// algorithm takes them: by labels, and edges with equal labels by ids, so
+/// the same graph always gives the same result.
+template<typename TWeightTraits, typename TIter>
+void sortIdEdges(TIter first, TIter last)
+{
+    typedef typename std::iterator_traits<TIter>::value_type Edge;
+
+    typename TWeightTraits::Compare less;
+    std::sort(first, last, [less](const Edge& a, const Edge& b)
+        {
+            if (less(a.lbl, b.lbl))
+                return true;
+            if (less(b.lbl, a.lbl))
+                return false;
+            return a.s < b.s || (a.s == b.s && a.d < b.d);
+        });
+}
+
+/// Finds a minimum spanning forest of a graph with \a vertices given by the
+/// array of its labeled \a edges using Kruskal's algorithm. The edges are
+/// sorted in place.
+template<typename Vertex, typename TWeightTraits, typename EdgeLbl, typename TVertexTable>
+std::set<std::pair<Vertex, Vertex> >
+findMSTKruskalOnEdges(const TVertexTable& vertices, std::size_t verticesNum,
+                      std::vector<IdEdge<EdgeLbl> >& edges)
+{
+    sortIdEdges<TWeightTraits>(edges.begin(), edges.end());
+
+    std::set<std::pair<Vertex, Vertex> > res;
+    DisjointSet components(verticesNum);
+    for (const IdEdge<EdgeLbl>& e : edges)
+    {
+        if (components.getSetsNum() == 1)
+            break;
+
+        // ids are ordered as vertices are and s < d, so the edge is normalized
+        if (components.unite(e.s, e.d))
+            res.insert(std::make_pair(vertices.getVertex(e.s), vertices.getVertex(e.d)));
     }
 
-    while (VisitedNodes.size() < g.getVerticesNum())
+    return res;
+}
+
+/// Collects labeled edges of the graph \a g (except for self-loops) into a flat
+/// array; vertices are translated into ids by the \a index.
+template<typename Vertex, typename EdgeLbl>
+std::vector<IdEdge<EdgeLbl> >
+makeIdEdges(const EdgeLblUGraph<Vertex, EdgeLbl>& g, const VertexIndex<Vertex>& index)
+{
+    typedef EdgeLblUGraph<Vertex, EdgeLbl> Graph;
+
+    std::vector<IdEdge<EdgeLbl> > edges;
+    edges.reserve(g.getEdgesNum());
+
+    typename Graph::EdgeLabelingCIterPair lblEdges = g.getLblEdges();
+    for (typename Graph::EdgeLabelingCIter it = lblEdges.first; it != lblEdges.second; ++it)
     {
-        Vertex item = UnvisitedNodes.getMin();
-        EdgeLbl itemCost = UnvisitedNodes.getCost(item);
-        UnvisitedNodes.remove(item);
-        VisitedNodes.insert(item);
+        if (it->first.first == it->first.second)
+            continue;                                   // self-loops never get into a MST
+
+        IdEdge<EdgeLbl> e = {index.getId(it->first.first), index.getId(it->first.second),
+                             it->second};
+        edges.push_back(e);
+    }
+
+    return edges;
+}
+
+/// Collects labeled edges of the snapshot \a g (except for self-loops) into a
+/// flat array.
+template<typename Vertex, typename EdgeLbl>
+std::vector<IdEdge<EdgeLbl> >
+makeIdEdges(const CsrSnapshot<Vertex, EdgeLbl>& g)
+{
+    typedef CsrSnapshot<Vertex, EdgeLbl> Graph;
 
-        typename EdgeLblUGraph<Vertex, EdgeLbl>::AdjListCIterPair rangeOfAdjV = g.getAdjEdges(item);
+    const VertexId n = static_cast<VertexId>(g.getVerticesNum());
+    std::vector<IdEdge<EdgeLbl> > edges;
+    edges.reserve(g.getEdgesNum());
 
-        for (auto it = rangeOfAdjV.first; it != rangeOfAdjV.second; ++it)
+    for (VertexId v = 0; v < n; ++v)
+    {
+        typename Graph::AdjCIterPair range = g.getAdjEdges(v);
+        for (typename Graph::AdjCIter it = range.first; it != range.second; ++it)
         {
-            Vertex adjNode = it->second;
-            EdgeLbl label;
-            g.getLabel(item, adjNode, label);
+            if (it->vertex <= v || !it->hasLbl)
+                continue;                               // every edge is taken once
 
-            if (VisitedNodes.find(adjNode) == VisitedNodes.end() 
-            && UnvisitedNodes.getCost(adjNode) > label)
-            {
-                UnvisitedNodes.set(adjNode, label);
-                MSTit = MST.find(adjNode);
-                if (MSTit == MST.end())
-                    MST.insert(std::make_pair(adjNode, item));
-                else
-                    MSTit->second = item;
-            }
+            IdEdge<EdgeLbl> e = {v, it->vertex, it->lbl};
+            edges.push_back(e);
         }
     }
-    for (MSTit = MST.begin(); MSTit != MST.end(); ++MSTit)
+
+    return edges;
+}
+
+/// Finds a MST for the given graph \a g using Kruskal's algorithm.
+///
+/// The contract is the same as for findMSTPrim(): only labeled edges are
+/// considered, a minimum spanning forest is returned for a disconnected graph
+/// and edges of the result are normalized.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>
+findMSTKruskal(const EdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    const VertexIndex<Vertex> index(g);
+    std::vector<IdEdge<EdgeLbl> > edges = makeIdEdges(g, index);
+
+    return findMSTKruskalOnEdges<Vertex, TWeightTraits>(index, index.getSize(), edges);
+}
+
+/// Finds a MST for the given snapshot \a g using Kruskal's algorithm.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename CsrSnapshot<Vertex, EdgeLbl>::Edge>
+findMSTKruskal(const CsrSnapshot<Vertex, EdgeLbl>& g)
+{
+    std::vector<IdEdge<EdgeLbl> > edges = makeIdEdges(g);
+
+    return findMSTKruskalOnEdges<Vertex, TWeightTraits>(g, g.getVerticesNum(), edges);
+}
+
+/// Finds a minimum spanning forest of a graph with \a vertices given by the
+/// array of its labeled \a edges using Borůvka's algorithm on the \a pool.
+/// Edges inside components are removed from the array.
+///
+/// Every round finds the lightest edge leaving every component in parallel,
+/// then merges components along these edges in parallel. Edges with equal
+/// labels are ordered by their positions, so the chosen edges never make a
+/// cycle.
+template<typename Vertex, typename TWeightTraits, typename EdgeLbl, typename TVertexTable>
+std::set<std::pair<Vertex, Vertex> >
+findMSTBoruvkaOnEdges(const TVertexTable& vertices, std::size_t verticesNum,
+                      std::vector<IdEdge<EdgeLbl> >& edges, WorkStealingPool& pool)
+{
+    typedef std::uint64_t EdgePos;
+    const EdgePos NoEdge = static_cast<EdgePos>(-1);
+
+    const std::size_t n = verticesNum;
+    ConcurrentDisjointSet components(n);
+    std::vector<VertexId> comp(n);                                  // components of vertices
+    std::unique_ptr<std::atomic<EdgePos>[]> best(new std::atomic<EdgePos>[n]);  // by components
+    for (std::size_t i = 0; i < n; ++i)
+        best[i].store(NoEdge, std::memory_order_relaxed);
+
+    // edges are split into fixed chunks; every chunk keeps its outgoing edges
+    // at its beginning, so the relative order of edges never changes
+    const std::size_t edgeGrain = pool.suggestGrain(edges.size());
+    const std::size_t vertexGrain = pool.suggestGrain(n);
+    const std::size_t chunksNum = (edges.size() + edgeGrain - 1) / edgeGrain;
+    std::vector<std::size_t> chunkEnds(chunksNum);
+    for (std::size_t c = 0; c < chunksNum; ++c)
+        chunkEnds[c] = std::min(edges.size(), (c + 1) * edgeGrain);
+
+    std::vector<std::pair<VertexId, VertexId> > chosen;
+    std::mutex chosenMutex;
+
+    typename TWeightTraits::Compare less;
+    auto relax = [&edges, less](std::atomic<EdgePos>& cur, EdgePos e)
     {
-        res.insert(std::make_pair(MSTit->first, MSTit->second));
+        EdgePos b = cur.load(std::memory_order_acquire);
+        while (b == NoEdge || less(edges[e].lbl, edges[b].lbl)
+               || (!less(edges[b].lbl, edges[e].lbl) && e < b))
+        {
+            if (cur.compare_exchange_weak(b, e, std::memory_order_acq_rel))
+                return;
+        }
+    };
+
+    for (;;)
+    {
+        pool.parallelFor(0, n, vertexGrain, [&](std::size_t from, std::size_t to)
+        {
+            for (std::size_t v = from; v < to; ++v)
+                comp[v] = components.find(static_cast<VertexId>(v));
+        });
+
+        pool.parallelFor(0, chunksNum, 1, [&](std::size_t from, std::size_t to)
+        {
+            for (std::size_t c = from; c < to; ++c)
+            {
+                std::size_t w = c * edgeGrain;
+                for (std::size_t r = w; r < chunkEnds[c]; ++r)
+                {
+                    VertexId cs = comp[edges[r].s];
+                    VertexId cd = comp[edges[r].d];
+                    if (cs == cd)
+                        continue;                           // the edge is inside
+
+                    if (w != r)
+                        edges[w] = edges[r];
+                    relax(best[cs], w);
+                    relax(best[cd], w);
+                    ++w;
+                }
+                chunkEnds[c] = w;
+            }
+        });
+
+        std::atomic<std::size_t> merged(0);
+        pool.parallelFor(0, n, vertexGrain, [&](std::size_t from, std::size_t to)
+        {
+            std::vector<std::pair<VertexId, VertexId> > local;
+            for (std::size_t v = from; v < to; ++v)
+            {
+                EdgePos e = best[v].load(std::memory_order_relaxed);
+                if (e == NoEdge)
+                    continue;
+
+                best[v].store(NoEdge, std::memory_order_relaxed);
+                if (components.unite(edges[e].s, edges[e].d))
+                    local.push_back(std::make_pair(edges[e].s, edges[e].d));
+            }
+
+            if (!local.empty())
+            {
+                std::lock_guard<std::mutex> lk(chosenMutex);
+                chosen.insert(chosen.end(), local.begin(), local.end());
+                merged.fetch_add(local.size(), std::memory_order_relaxed);
+            }
+        });
+
+        if (merged.load() == 0)
+            break;
     }
+
+    std::set<std::pair<Vertex, Vertex> > res;
+    for (const std::pair<VertexId, VertexId>& e : chosen)
+        res.insert(std::make_pair(vertices.getVertex(e.first), vertices.getVertex(e.second)));
+
     return res;
 }
 
+/// Finds a MST for the given graph \a g using Borůvka's algorithm run on the
+/// given \a pool.
+///
+/// The contract is the same as for findMSTPrim().
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>
+findMSTParallel(const EdgeLblUGraph<Vertex, EdgeLbl>& g, WorkStealingPool& pool)
+{
+    const VertexIndex<Vertex> index(g);
+    std::vector<IdEdge<EdgeLbl> > edges = makeIdEdges(g, index);
+
+    return findMSTBoruvkaOnEdges<Vertex, TWeightTraits>(index, index.getSize(), edges, pool);
+}
+
+/// Finds a MST for the given graph \a g using Borůvka's algorithm run on a
+/// new pool of \a threadsNum threads (0 means the number of hardware threads).
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>
+findMSTParallel(const EdgeLblUGraph<Vertex, EdgeLbl>& g, std::size_t threadsNum = 0)
+{
+    WorkStealingPool pool(threadsNum);
+    return findMSTParallel<Vertex, EdgeLbl, TWeightTraits>(g, pool);
+}
+
+/// Finds a MST for the given snapshot \a g using Borůvka's algorithm run on
+/// the given \a pool.
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename CsrSnapshot<Vertex, EdgeLbl>::Edge>
+findMSTParallel(const CsrSnapshot<Vertex, EdgeLbl>& g, WorkStealingPool& pool)
+{
+    std::vector<IdEdge<EdgeLbl> > edges = makeIdEdges(g);
+
+    return findMSTBoruvkaOnEdges<Vertex, TWeightTraits>(g, g.getVerticesNum(), edges, pool);
+}
+
+/// Finds a MST for the given snapshot \a g using Borůvka's algorithm run on
+/// a new pool of \a threadsNum threads (0 means the number of hardware
+/// threads).
+template<typename Vertex, typename EdgeLbl,
+         typename TWeightTraits = WeightTraits<EdgeLbl> >
+std::set<typename CsrSnapshot<Vertex, EdgeLbl>::Edge>
+findMSTParallel(const CsrSnapshot<Vertex, EdgeLbl>& g, std::size_t threadsNum = 0)
+{
+    WorkStealingPool pool(threadsNum);
+    return findMSTParallel<Vertex, EdgeLbl, TWeightTraits>(g, pool);
+}
+
 #endif // UGRAPH_ALGOS_HPP
@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for dense numbering of
+///             vertices of undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef VERTEX_INDEX_HPP
+#define VERTEX_INDEX_HPP
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+#include "ugraph.hpp"
+
+
+/// Dense id of a vertex: a number from 0..V-1.
+typedef std::uint32_t VertexId;
+
+
+/*! ****************************************************************************
+ *  \brief The VertexIndex class assigns dense ids 0..V-1 to vertices of a graph.
+ *
+ *  Ids follow the order of vertices, so the smaller vertex always gets the
+ *  smaller id. Vertices are kept in a sorted array, hence getting a vertex by
+ *  its id takes O(1) time and getting an id of a vertex takes O(log V) time.
+ *  Algorithms are supposed to translate vertices into ids once and to keep
+ *  their state in arrays indexed by ids.
+ *
+ *  Only for vertices of an integral type whose span (the greatest vertex minus
+ *  the smallest one) is less than TableSpan times the number of vertices,
+ *  e.g. 0..V-1, ids are also put into a table by values, and getting an id
+ *  takes O(1) time. Ids of all other vertices, such as strings or integers
+ *  scattered more widely, are still searched for in O(log V) time.
+ *
+ *  \tparam Vertex represents a type for vertices. See requirements for UGraph.
+ ******************************************************************************/
+template <typename Vertex>
+class VertexIndex {
+public:
+    /// Denotes an absent id.
+    static const VertexId NoId = static_cast<VertexId>(-1);
+
+    /// Max ratio of the span of integer vertices to their number for the
+    /// table of ids to be made.
+    static const std::size_t TableSpan = 4;
+
+public:
+    /// Creates an empty index.
+    VertexIndex() {}
+
+    /// Numbers the vertices of the given graph \a g (a UGraph, an
+    /// EdgeLblUGraph or a CsrSnapshot).
+    template <typename TGraph>
+    explicit VertexIndex(const TGraph& g)
+    {
+        reset(g);
+    }
+
+    /// Numbers the vertices of the range [\a first, \a last) that can be
+    /// unsorted and can contain duplicates.
+    template <typename InputIt>
+    VertexIndex(InputIt first, InputIt last)
+    {
+        assign(first, last, false);
+    }
+
+    /// Renumbers the vertices of the given graph \a g; the memory of the index
+    /// is reused.
+    template <typename TGraph>
+    void reset(const TGraph& g)
+    {
+        // vertices of graphs and snapshots are sorted and unique already
+        auto vs = g.getVertices();
+        assign(vs.first, vs.second, true);
+    }
+
+public:
+    // setters/getters
+    std::size_t getSize() const { return _vertices.size(); }
+    bool isEmpty() const { return _vertices.empty(); }
+
+    /// Returns the vertex with the id \a id.
+    const Vertex& getVertex(VertexId id) const { return _vertices[id]; }
+
+    /// Returns all the vertices ordered by their ids.
+    const std::vector<Vertex>& getVertices() const { return _vertices; }
+
+    /// Looks for the id of the vertex \a v.
+    ///
+    /// \return true if the vertex is indexed and \a id is assigned to its id;
+    /// false otherwise.
+    bool findId(const Vertex& v, VertexId& id) const
+    {
+        if (!_ids.empty())
+            return findTableId(v, id, std::is_integral<Vertex>());
+
+        typename std::vector<Vertex>::const_iterator it =
+            std::lower_bound(_vertices.begin(), _vertices.end(), v);
+        if (it == _vertices.end() || v < *it)
+            return false;
+
+        id = static_cast<VertexId>(it - _vertices.begin());
+        return true;
+    }
+
+    /// Returns the id of the vertex \a v or NoId if it is not indexed.
+    VertexId getId(const Vertex& v) const
+    {
+        VertexId id;
+        return findId(v, id) ? id : NoId;
+    }
+
+    /// Moves the sorted vertices out of the index leaving it empty.
+    std::vector<Vertex> release()
+    {
+        std::vector<Vertex> res;
+        res.swap(_vertices);
+        _ids.clear();
+        return res;
+    }
+
+protected:
+    /// Fills the index with the vertices from [\a first, \a last).
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last, bool sortedUnique)
+    {
+        _vertices.assign(first, last);
+        if (!sortedUnique)
+        {
+            std::sort(_vertices.begin(), _vertices.end());
+            _vertices.erase(std::unique(_vertices.begin(), _vertices.end(),
+                [](const Vertex& a, const Vertex& b) { return !(a < b) && !(b < a); }),
+                _vertices.end());
+        }
+
+        if (_vertices.size() >= NoId)
+            throw std::length_error("Too many vertices to be indexed");
+
+        makeTable(std::is_integral<Vertex>());
+    }
+
+    /// Makes the table of ids of integer vertices if their span is small
+    /// enough.
+    void makeTable(std::true_type)
+    {
+        _ids.clear();
+        if (_vertices.empty())
+            return;
+
+        // the difference of unsigned values is the span for signed types too
+        const unsigned long long span = static_cast<unsigned long long>(_vertices.back())
+                                        - static_cast<unsigned long long>(_vertices.front());
+        if (span >= TableSpan * _vertices.size())
+            return;
+
+        _ids.assign(static_cast<std::size_t>(span) + 1, NoId);
+        for (std::size_t i = 0; i < _vertices.size(); ++i)
+            _ids[getTablePos(_vertices[i])] = static_cast<VertexId>(i);
+    }
+
+    /// Vertices of other types are only searched in the sorted array.
+    void makeTable(std::false_type)
+    {
+    }
+
+    /// Returns the position of the integer vertex \a v in the table of ids.
+    std::size_t getTablePos(const Vertex& v) const
+    {
+        return static_cast<std::size_t>(static_cast<unsigned long long>(v)
+                                        - static_cast<unsigned long long>(_vertices.front()));
+    }
+
+    /// Looks for the id of the integer vertex \a v in the table of ids.
+    bool findTableId(const Vertex& v, VertexId& id, std::true_type) const
+    {
+        if (v < _vertices.front() || _vertices.back() < v)
+            return false;
+
+        id = _ids[getTablePos(v)];
+        return id != NoId;
+    }
+
+    /// Never called: there is no table for vertices of other types.
+    bool findTableId(const Vertex&, VertexId&, std::false_type) const
+    {
+        return false;
+    }
+
+protected:
+    std::vector<Vertex> _vertices;          ///< Sorted vertices.
+    std::vector<VertexId> _ids;             ///< Ids of integer vertices by values.
+}; // class VertexIndex
+
+template <typename Vertex>
+const VertexId VertexIndex<Vertex>::NoId;
+
+template <typename Vertex>
+const std::size_t VertexIndex<Vertex>::TableSpan;
+
+
+
+#endif // VERTEX_INDEX_HPP
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains traits describing how edge labels are used as weights
+///             by the graph algorithms.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef WEIGHT_TRAITS_HPP
+#define WEIGHT_TRAITS_HPP
+
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+
+
+/*! ****************************************************************************
+ *  \brief The WeightTraits class describes a type of edge labels used as
+ *  weights: its zero, its infinity and a strict weak ordering of weights.
+ *
+ *  The general template suits any type that has a default value being its zero,
+ *  operator< and std::numeric_limits. Integer and floating point types have
+ *  specializations below; other types (or other orderings) can be supported by
+ *  specializing the template or by passing another traits class with the same
+ *  members to the algorithms.
+ *
+ *  \tparam Weight represents a type for weights.
+ ******************************************************************************/
+template <typename Weight, typename Enable = void>
+struct WeightTraits {
+    /// Strict weak ordering of weights; the lighter weight is the less one.
+    typedef std::less<Weight> Compare;
+
+    /// Weight of an empty path.
+    static Weight zero() { return Weight(); }
+
+    /// Weight that is not less than any other weight.
+    static Weight infinity()
+    {
+        return std::numeric_limits<Weight>::has_infinity
+            ? std::numeric_limits<Weight>::infinity()
+            : std::numeric_limits<Weight>::max();
+    }
+}; // struct WeightTraits
+
+
+/// Integer weights: keys are compared by a single instruction.
+template <typename Weight>
+struct WeightTraits<Weight, typename std::enable_if<std::is_integral<Weight>::value>::type> {
+    typedef std::less<Weight> Compare;
+
+    static Weight zero() { return 0; }
+    static Weight infinity() { return std::numeric_limits<Weight>::max(); }
+}; // struct WeightTraits
+
+
+/// Floating point weights: NaN is heavier than any number (including the
+/// infinity), so the ordering stays strict weak and NaN-labeled edges get into
+/// a MST only if there is no other choice.
+template <typename Weight>
+struct WeightTraits<Weight, typename std::enable_if<std::is_floating_point<Weight>::value>::type> {
+    struct Compare {
+        bool operator()(Weight a, Weight b) const
+        {
+            return a < b || (b != b && a == a);
+        }
+    };
+
+    static Weight zero() { return 0; }
+    static Weight infinity() { return std::numeric_limits<Weight>::infinity(); }
+}; // struct WeightTraits
+
+
+
+#endif // WEIGHT_TRAITS_HPP
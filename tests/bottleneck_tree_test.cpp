@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for bottleneck path queries.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ugraph/bottleneck_tree.hpp"
+#include "test_graphs.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef BottleneckTree<int, int> IntIntBottleneckTree;
+
+
+TEST(BottleneckTree, simple)
+{
+    // 10 -1- 20 -5- 30 -2- 40   50 -3- 60   70
+    //         \-4- 80
+    std::vector<LblEdge<int, int> > edges = {{30, 20, 5}, {10, 20, 1}, {50, 60, 3},
+                                             {30, 40, 2}, {20, 80, 4}};
+    IntIntBottleneckTree bt({70, 10, 20, 30, 40, 50, 60, 80, 10}, edges);
+    ASSERT_EQ(8, bt.getVerticesNum());
+    EXPECT_EQ(20, bt.getVertex(1));
+    EXPECT_EQ(3, bt.getDepth(bt.getId(40)));
+    EXPECT_EQ(2, bt.getLevelsNum());
+
+    int lbl = 0;
+    EXPECT_TRUE(bt.getBottleneck(10, 40, lbl));
+    EXPECT_EQ(5, lbl);
+    EXPECT_TRUE(bt.getBottleneck(40, 30, lbl));
+    EXPECT_EQ(2, lbl);
+    EXPECT_TRUE(bt.getBottleneck(80, 10, lbl));
+    EXPECT_EQ(4, lbl);
+    EXPECT_TRUE(bt.getBottleneck(80, 40, lbl));
+    EXPECT_EQ(5, lbl);
+    EXPECT_TRUE(bt.getBottleneck(60, 50, lbl));
+    EXPECT_EQ(3, lbl);
+
+    lbl = -1;
+    EXPECT_FALSE(bt.getBottleneck(30, 30, lbl));
+    EXPECT_FALSE(bt.getBottleneck(10, 50, lbl));
+    EXPECT_FALSE(bt.getBottleneck(70, 60, lbl));
+    EXPECT_EQ(-1, lbl);
+    EXPECT_THROW(bt.getBottleneck(10, 90, lbl), std::out_of_range);
+
+    std::vector<int> res;
+    bt.getBottlenecks({{10, 40}, {50, 60}, {10, 70}, {20, 20}}, res);
+    EXPECT_EQ((std::vector<int>{5, 3, WeightTraits<int>::infinity(),
+                                WeightTraits<int>::infinity()}), res);
+    EXPECT_THROW(bt.getBottlenecks({{10, 40}, {10, 90}}, res), std::out_of_range);
+
+    IntIntBottleneckTree empty({}, {});
+    EXPECT_EQ(0, empty.getLevelsNum());
+    empty.getBottlenecksOfIds({}, res);
+    EXPECT_TRUE(res.empty());
+}
+
+
+TEST(BottleneckTree, errors)
+{
+    std::vector<LblEdge<int, int> > cycle = {{1, 2, 1}, {2, 3, 1}, {1, 3, 1}};
+    EXPECT_THROW(IntIntBottleneckTree({1, 2, 3}, cycle), std::invalid_argument);
+
+    std::vector<LblEdge<int, int> > unknown = {{1, 4, 1}};
+    EXPECT_THROW(IntIntBottleneckTree({1, 2, 3}, unknown), std::invalid_argument);
+}
+
+
+// Tests a path deep enough for many levels of jumps.
+TEST(BottleneckTree, path)
+{
+    const int n = 1000;
+    std::vector<int> vertices;
+    std::vector<LblEdge<int, int> > edges;
+    for (int v = 0; v < n; ++v)
+    {
+        vertices.push_back(v);
+        if (v)
+            edges.push_back({v - 1, v, (v * 37) % 101});
+    }
+
+    IntIntBottleneckTree bt(vertices, edges);
+    EXPECT_EQ(10, bt.getLevelsNum());
+    for (int u = 0; u < n; u += 13)
+    {
+        int expected = -1;
+        for (int v = u + 1; v < n; ++v)
+        {
+            expected = std::max(expected, (v * 37) % 101);
+            int lbl;
+            ASSERT_TRUE(bt.getBottleneck(v, u, lbl));
+            EXPECT_EQ(expected, lbl);
+        }
+    }
+}
+
+
+// Tests that the bottleneck of a pair is the least threshold making the
+// pair connected by the edges not heavier than it, for a graph and its
+// snapshot, sequentially and on a pool.
+TEST(BottleneckTree, sameAsComponents)
+{
+    IntIntGraph g;
+    for (int v = 0; v < 400; ++v)
+        g.addVertex(v * 3);
+    forRandomEdges(400, 700, 25, [&g](int s, int d, int, const TestRandom& rnd)
+    {
+        g.addLblEdge(s * 3, d * 3, (rnd.getLast() >> 4) % 30);
+    });
+
+    IntIntBottleneckTree bt = makeBottleneckTree(g);
+    IntIntBottleneckTree bts = makeBottleneckTree(g.freeze());
+    const VertexIndex<int> index(g);
+
+    std::vector<IntIntBottleneckTree::Query> queries;
+    std::vector<int> expected;
+    for (int t = 0; t < 30; ++t)
+    {
+        DisjointSet comps(index.getSize());
+        IntIntGraph::EdgeLabelingCIterPair lblEdges = g.getLblEdges();
+        for (IntIntGraph::EdgeLabelingCIter it = lblEdges.first; it != lblEdges.second; ++it)
+        {
+            if (it->second <= t)
+                comps.unite(index.getId(it->first.first), index.getId(it->first.second));
+        }
+
+        // pairs become connected at their bottlenecks
+        for (std::size_t u = t; u < index.getSize(); u += 7)
+        {
+            for (std::size_t v = u + 1; v < index.getSize(); v += 29)
+            {
+                int lbl = -1;
+                const bool found = bt.getBottleneck(index.getVertex(u), index.getVertex(v), lbl);
+                EXPECT_EQ(comps.isSameSet(u, v), found && lbl <= t);
+                if (t == 0)
+                {
+                    queries.push_back({index.getVertex(u), index.getVertex(v)});
+                    expected.push_back(found ? lbl : WeightTraits<int>::infinity());
+                }
+            }
+        }
+    }
+
+    std::vector<int> res;
+    bts.getBottlenecks(queries, res);
+    EXPECT_EQ(expected, res);
+
+    WorkStealingPool pool(4);
+    res.clear();
+    bt.getBottlenecks(queries, res, &pool, 16);
+    EXPECT_EQ(expected, res);
+}
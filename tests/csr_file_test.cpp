@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for binary files with CSR snapshots.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <cstddef>
+
+#include "ugraph/csr_file.hpp"
+#include "ugraph/ugraph_algos.hpp"
+
+#ifndef GV_OUT_DIR
+#define GV_OUT_DIR "f:/temp/2020/20200922/gv/"
+#endif
+
+
+typedef EdgeLblUGraph<int, double> IntDblGraph;
+
+
+TEST(CsrFile, writeAndMap)
+{
+    IntDblGraph g;
+    g.addLblEdge(10, 20, 1.5);
+    g.addLblEdge(20, 30, 0.5);
+    g.addLblEdge(10, 30, 2.5);
+    g.addEdge(30, 40);
+    g.addLblEdge(40, 40, 9.0);
+    g.addVertex(50);
+
+    IntDblGraph::Snapshot sn = g.freeze();
+    writeCsrSnapshot(GV_OUT_DIR "graph1.csr", sn);
+
+    IntDblGraph::Snapshot mapped = mapCsrSnapshot<int, double>(GV_OUT_DIR "graph1.csr");
+    EXPECT_EQ(sn.getVerticesNum(), mapped.getVerticesNum());
+    EXPECT_EQ(sn.getEdgesNum(), mapped.getEdgesNum());
+    EXPECT_TRUE(mapped.isVertexExists(50));
+
+    double lbl;
+    EXPECT_TRUE(mapped.getLabel(30, 20, lbl));
+    EXPECT_EQ(0.5, lbl);
+    EXPECT_TRUE(mapped.getLabel(40, 40, lbl));
+    EXPECT_EQ(9.0, lbl);
+    EXPECT_FALSE(mapped.getLabel(30, 40, lbl));
+
+    EXPECT_EQ(findMSTPrim(sn), findMSTPrim(mapped));
+    EXPECT_EQ(findMSTKruskal(g), findMSTKruskal(mapped));
+
+    // copies keep the mapping alive
+    IntDblGraph::Snapshot copy = mapped;
+    mapped = IntDblGraph::Snapshot();
+    EXPECT_TRUE(copy.getLabel(10, 20, lbl));
+    EXPECT_EQ(1.5, lbl);
+}
+
+TEST(CsrFile, empty)
+{
+    writeCsrSnapshot(GV_OUT_DIR "graph2.csr", IntDblGraph().freeze());
+    IntDblGraph::Snapshot mapped = mapCsrSnapshot<int, double>(GV_OUT_DIR "graph2.csr");
+    EXPECT_EQ(0, mapped.getVerticesNum());
+    EXPECT_EQ(0, mapped.getEdgesNum());
+}
+
+TEST(CsrFile, errors)
+{
+    EXPECT_THROW((mapCsrSnapshot<int, double>(GV_OUT_DIR "no_such_file.csr")),
+                 std::invalid_argument);
+
+    IntDblGraph g;
+    g.addLblEdge(1, 2, 3.0);
+    writeCsrSnapshot(GV_OUT_DIR "graph3.csr", g.freeze());
+
+    // other label type
+    EXPECT_THROW((mapCsrSnapshot<int, float>(GV_OUT_DIR "graph3.csr")),
+                 std::invalid_argument);
+
+    // not a CSR file
+    {
+        std::ofstream f(GV_OUT_DIR "graph4.csr");
+        f << "1 2 3.0\n";
+    }
+    EXPECT_THROW((mapCsrSnapshot<int, double>(GV_OUT_DIR "graph4.csr")),
+                 std::invalid_argument);
+
+    // truncated file
+    {
+        std::ifstream in(GV_OUT_DIR "graph3.csr", std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(in)),
+                            std::istreambuf_iterator<char>());
+        std::ofstream out(GV_OUT_DIR "graph5.csr", std::ios::binary);
+        out.write(content.data(), content.size() - 8);
+    }
+    EXPECT_THROW((mapCsrSnapshot<int, double>(GV_OUT_DIR "graph5.csr")),
+                 std::invalid_argument);
+}
+
+
+// Overwrites the value of the type T at the position pos of the file fn.
+template <typename T>
+static void patchFile(const char* fn, std::uint64_t pos, const T& x)
+{
+    std::fstream f(fn, std::ios::binary | std::ios::in | std::ios::out);
+    f.seekp(static_cast<std::streamoff>(pos));
+    f.write(reinterpret_cast<const char*>(&x), sizeof(x));
+}
+
+// Tests files with consistent headers but corrupted sizes and content.
+TEST(CsrFile, corrupted)
+{
+    typedef IntDblGraph::Snapshot Snapshot;
+    IntDblGraph g;
+    g.addLblEdge(1, 2, 3.0);
+    g.addLblEdge(2, 3, 4.0);
+    g.addLblEdge(3, 1, 5.0);
+    const char* fn = GV_OUT_DIR "graph6.csr";
+    const CsrFileHeader h = makeCsrFileHeader<int, double>(3, 6);
+
+    // sizes making positions overflow
+    writeCsrSnapshot(fn, g.freeze());
+    patchFile(fn, offsetof(CsrFileHeader, verticesNum), std::uint64_t(1) << 62);
+    EXPECT_THROW((mapCsrSnapshot<int, double>(fn)), std::invalid_argument);
+    writeCsrSnapshot(fn, g.freeze());
+    patchFile(fn, offsetof(CsrFileHeader, adjEntriesNum), ~std::uint64_t(0) / 2);
+    EXPECT_THROW((mapCsrSnapshot<int, double>(fn)), std::invalid_argument);
+
+    // offsets going back
+    writeCsrSnapshot(fn, g.freeze());
+    patchFile(fn, h.offsetsPos + sizeof(Snapshot::Offset), Snapshot::Offset(5));
+    EXPECT_THROW((mapCsrSnapshot<int, double>(fn)), std::invalid_argument);
+    EXPECT_NO_THROW((mapCsrSnapshot<int, double>(fn, true)));    // not checked
+
+    // the first offset is not 0
+    writeCsrSnapshot(fn, g.freeze());
+    patchFile(fn, h.offsetsPos, Snapshot::Offset(1));
+    EXPECT_THROW((mapCsrSnapshot<int, double>(fn)), std::invalid_argument);
+
+    // the last offset is not the number of entries
+    writeCsrSnapshot(fn, g.freeze());
+    patchFile(fn, h.offsetsPos + 3 * sizeof(Snapshot::Offset), Snapshot::Offset(5));
+    EXPECT_THROW((mapCsrSnapshot<int, double>(fn, true)), std::invalid_argument);
+
+    // a neighbour out of vertices
+    writeCsrSnapshot(fn, g.freeze());
+    patchFile(fn, h.adjPos + 4 * sizeof(Snapshot::AdjEntry)
+                  + offsetof(Snapshot::AdjEntry, vertex), VertexId(3));
+    EXPECT_THROW((mapCsrSnapshot<int, double>(fn)), std::invalid_argument);
+
+    writeCsrSnapshot(fn, g.freeze());
+    EXPECT_EQ(findMSTKruskal(g), findMSTKruskal(mapCsrSnapshot<int, double>(fn)));
+}
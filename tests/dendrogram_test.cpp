@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for single-linkage dendrograms.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ugraph/dendrogram.hpp"
+#include "test_graphs.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef Dendrogram<int, int> IntIntDendrogram;
+typedef std::vector<std::size_t> Labels;
+
+
+// Tests merges and both kinds of cuts on a small forest.
+TEST(Dendrogram, simple)
+{
+    // 10 -1- 20 -5- 30 -2- 40   50 -3- 60   70
+    std::vector<LblEdge<int, int> > edges = {{30, 20, 5}, {10, 20, 1}, {50, 60, 3},
+                                             {30, 40, 2}};
+    IntIntDendrogram d({70, 10, 20, 30, 40, 50, 60, 10}, edges);
+    ASSERT_EQ(7, d.getVerticesNum());
+    EXPECT_EQ(10, d.getVertex(0));
+    EXPECT_EQ(3, d.getMinClustersNum());
+
+    const std::vector<IntIntDendrogram::Merge>& merges = d.getMerges();
+    ASSERT_EQ(4, merges.size());
+    EXPECT_EQ(0, merges[0].left);                   // {10, 20}
+    EXPECT_EQ(1, merges[0].right);
+    EXPECT_EQ(1, merges[0].height);
+    EXPECT_EQ(2, merges[1].left);                   // {30, 40}
+    EXPECT_EQ(3, merges[2].height);                 // {50, 60}
+    EXPECT_EQ(7, merges[3].left);                   // the nodes of the first
+    EXPECT_EQ(8, merges[3].right);                  // and the second merges
+    EXPECT_EQ(4, merges[3].size);
+    EXPECT_EQ(10, d.getParent(7));
+    EXPECT_EQ(IntIntDendrogram::NoNode, d.getParent(10));
+
+    Labels labels;
+    EXPECT_EQ(7, d.getClustersAt(0, labels));
+    EXPECT_EQ((Labels{0, 1, 2, 3, 4, 5, 6}), labels);
+    EXPECT_EQ(5, d.getClustersAt(2, labels));
+    EXPECT_EQ((Labels{0, 0, 1, 1, 2, 3, 4}), labels);
+    EXPECT_EQ(3, d.getClustersAt(100, labels));
+    EXPECT_EQ((Labels{0, 0, 0, 0, 1, 1, 2}), labels);
+
+    EXPECT_EQ(4, d.getClusters(4, labels));
+    EXPECT_EQ((Labels{0, 0, 1, 1, 2, 2, 3}), labels);
+    EXPECT_THROW(d.getClusters(2, labels), std::out_of_range);
+    EXPECT_THROW(d.getClusters(8, labels), std::out_of_range);
+
+    IntIntDendrogram empty({}, {});
+    EXPECT_EQ(0, empty.getClustersAt(5, labels));
+    EXPECT_TRUE(labels.empty());
+}
+
+
+TEST(Dendrogram, errors)
+{
+    std::vector<LblEdge<int, int> > cycle = {{1, 2, 1}, {2, 3, 1}, {1, 3, 1}};
+    EXPECT_THROW(IntIntDendrogram({1, 2, 3}, cycle), std::invalid_argument);
+
+    std::vector<LblEdge<int, int> > unknown = {{1, 4, 1}};
+    EXPECT_THROW(IntIntDendrogram({1, 2, 3}, unknown), std::invalid_argument);
+}
+
+
+// Tests that clusters at every threshold are components of the graph made
+// by the edges not heavier than it.
+TEST(Dendrogram, sameAsComponents)
+{
+    IntIntGraph g;
+    for (int v = 0; v < 500; ++v)
+        g.addVertex(v * 2);
+    forRandomEdges(500, 900, 23, [&g](int s, int d, int, const TestRandom& rnd)
+    {
+        g.addLblEdge(s * 2, d * 2, (rnd.getLast() >> 4) % 20);
+    });
+
+    IntIntDendrogram d = makeDendrogram(g);
+    IntIntDendrogram ds = makeDendrogram(g.freeze());
+    EXPECT_EQ(d.getMerges().size(), ds.getMerges().size());
+    const VertexIndex<int> index(g);
+
+    Labels labels;
+    for (int t = -1; t <= 20; ++t)
+    {
+        DisjointSet comps(index.getSize());
+        IntIntGraph::EdgeLabelingCIterPair lblEdges = g.getLblEdges();
+        for (IntIntGraph::EdgeLabelingCIter it = lblEdges.first; it != lblEdges.second; ++it)
+        {
+            if (it->second <= t)
+                comps.unite(index.getId(it->first.first), index.getId(it->first.second));
+        }
+
+        EXPECT_EQ(comps.getSetsNum(), d.getClustersAt(t, labels));
+        for (std::size_t u = 0; u < labels.size(); ++u)
+        {
+            for (std::size_t v = u + 1; v < labels.size(); v += 37)
+                EXPECT_EQ(comps.isSameSet(u, v), labels[u] == labels[v]);
+        }
+    }
+
+    for (std::size_t k = d.getMinClustersNum(); k <= d.getVerticesNum(); k += 50)
+    {
+        EXPECT_EQ(k, d.getClusters(k, labels));
+        EXPECT_EQ(k, *std::max_element(labels.begin(), labels.end()) + 1);
+        EXPECT_EQ(0, labels[0]);
+    }
+}
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the disjoint-set structure.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ugraph/disjoint_set.hpp"
+
+
+TEST(DisjointSet, singletons)
+{
+    DisjointSet ds(5);
+    EXPECT_EQ(5, ds.getSize());
+    EXPECT_EQ(5, ds.getSetsNum());
+    for(DisjointSet::Elem i = 0; i < 5; ++i)
+        EXPECT_EQ(i, ds.find(i));
+    EXPECT_FALSE(ds.isSameSet(0, 1));
+}
+
+TEST(DisjointSet, unite)
+{
+    DisjointSet ds(6);
+    EXPECT_TRUE(ds.unite(0, 1));
+    EXPECT_TRUE(ds.unite(2, 3));
+    EXPECT_TRUE(ds.unite(1, 3));
+    EXPECT_FALSE(ds.unite(0, 2));
+    EXPECT_EQ(3, ds.getSetsNum());
+
+    EXPECT_TRUE(ds.isSameSet(0, 3));
+    EXPECT_TRUE(ds.isSameSet(2, 1));
+    EXPECT_FALSE(ds.isSameSet(0, 4));
+    EXPECT_FALSE(ds.isSameSet(4, 5));
+
+    ds.reset(3);
+    EXPECT_EQ(3, ds.getSetsNum());
+    EXPECT_FALSE(ds.isSameSet(0, 1));
+
+    EXPECT_EQ(3, ds.addElem());
+    EXPECT_EQ(4, ds.getSetsNum());
+    EXPECT_TRUE(ds.unite(3, 0));
+    EXPECT_TRUE(ds.isSameSet(0, 3));
+}
+
+// Builds a long chain and checks that all of it ends up in a single set.
+TEST(DisjointSet, chain)
+{
+    const std::size_t n = 10000;
+    DisjointSet ds(n);
+    for(std::size_t i = 1; i < n; ++i)
+        EXPECT_TRUE(ds.unite(i - 1, i));
+
+    EXPECT_EQ(1, ds.getSetsNum());
+    DisjointSet::Elem root = ds.find(0);
+    for(std::size_t i = 0; i < n; ++i)
+        EXPECT_EQ(root, ds.find(i));
+}
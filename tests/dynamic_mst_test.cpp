@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the MST maintained under edge insertions.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ugraph/dynamic_mst.hpp"
+#include "test_graphs.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef DynamicMST<int, int> IntIntDynamicMST;
+
+
+TEST(DynamicMST, simple)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 5);
+    g.addLblEdge(2, 3, 4);
+    g.addEdge(3, 4);
+
+    IntIntDynamicMST mst(g);
+    EXPECT_EQ(2, mst.getEdgesNum());
+    EXPECT_EQ(9, mst.getWeight());
+    EXPECT_FALSE(mst.isConnected(1, 4));
+
+    mst.addLblEdge(3, 4, 7);                        // links a new vertex
+    EXPECT_TRUE(mst.isConnected(1, 4));
+    EXPECT_TRUE(mst.isTreeEdge(4, 3));
+
+    mst.addLblEdge(1, 3, 6);                        // heavier than the cycle
+    EXPECT_FALSE(mst.isTreeEdge(1, 3));
+
+    mst.addLblEdge(4, 1, 2);                        // replaces {3, 4}
+    std::set<IntIntGraph::Edge> expected = {{1, 2}, {1, 4}, {2, 3}};
+    EXPECT_EQ(expected, mst.getEdges());
+    EXPECT_EQ(11, mst.getWeight());
+
+    mst.addLblEdge(5, 5, 0);                        // a self-loop
+    EXPECT_EQ(expected, mst.getEdges());
+    EXPECT_EQ(expected, findMSTPrim(mst.getGraph()));
+    EXPECT_EQ(2, mst.getNonTreeEdgesNum());
+
+    mst.addLblEdge(1, 3, 1);                        // a lighter non-tree edge
+    expected = {{1, 3}, {1, 4}, {2, 3}};
+    EXPECT_EQ(expected, mst.getEdges());
+    EXPECT_EQ(7, mst.getWeight());
+
+    mst.addLblEdge(1, 3, 0);                        // a lighter tree edge
+    EXPECT_EQ(expected, mst.getEdges());
+    EXPECT_EQ(6, mst.getWeight());
+    EXPECT_EQ(2, mst.getNonTreeEdgesNum());
+
+    mst.addLblEdge(1, 3, 0);                        // the same label
+    EXPECT_EQ(6, mst.getWeight());
+
+    // edges cannot get heavier
+    EXPECT_THROW(mst.addLblEdge(1, 2, 100), std::invalid_argument);
+    EXPECT_THROW(mst.addLblEdge(3, 1, 1), std::invalid_argument);
+    int lbl = 0;
+    EXPECT_TRUE(g.getLabel(1, 2, lbl));
+    EXPECT_EQ(5, lbl);
+    EXPECT_EQ(expected, mst.getEdges());
+    EXPECT_EQ(findMSTPrim(mst.getGraph()), mst.getEdges());
+}
+
+// Adds random edges w/ distinct labels one by one and compares the MST w/ the
+// one found from scratch.
+TEST(DynamicMST, random)
+{
+    IntIntGraph g;
+    IntIntDynamicMST mst(g);
+    forRandomEdges(200, 1500, 23, [&](int s, int d, int i, const TestRandom&)
+    {
+        int lbl = i * 7919 % 1500;
+        int oldLbl = 0;
+        if(!g.getLabel(s, d, oldLbl) || lbl < oldLbl)
+            mst.addLblEdge(s, d, lbl);              // edges cannot get heavier
+
+        if(i % 100 == 0)
+        {
+            EXPECT_EQ(findMSTKruskal(g), mst.getEdges()) << i;
+        }
+    });
+    EXPECT_EQ(findMSTKruskal(g), mst.getEdges());
+
+    // attaching to a nonempty graph
+    IntIntDynamicMST other(g);
+    EXPECT_EQ(mst.getEdges(), other.getEdges());
+    EXPECT_EQ(mst.getWeight(), other.getWeight());
+}
+
+// Makes random edges lighter and compares the MST w/ the one found from
+// scratch.
+TEST(DynamicMST, randomDecrease)
+{
+    IntIntGraph g;
+    TestRandom rnd(29);
+    for(int i = 0; i < 600; ++i)
+        g.addLblEdge(rnd.next(150), rnd.next(150), rnd.next(1000000));
+
+    IntIntDynamicMST mst(g);
+    for(int step = 0; step < 3000; ++step)
+    {
+        int s = rnd.next(150);
+        int d = rnd.next(150);
+        int lbl = 1000000;
+        g.getLabel(s, d, lbl);
+        mst.addLblEdge(s, d, static_cast<int>(rnd.next(lbl + 1)));
+
+        if(step % 100 == 0)
+        {
+            ASSERT_EQ(findMSTKruskal(g), mst.getEdges()) << step;
+            EXPECT_EQ(findMSTEdges(g).weight, mst.getWeight());
+        }
+    }
+    EXPECT_EQ(findMSTKruskal(g), mst.getEdges());
+}
@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for Euclidean minimum spanning trees.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ugraph/euclidean_mst.hpp"
+#include "test_graphs.hpp"
+
+
+// Finds a MST of the complete graph of the \a points by findMSTKruskal().
+template <std::size_t Dim>
+static std::set<std::pair<std::size_t, std::size_t> >
+findCompleteGraphMST(const std::vector<std::array<double, Dim> >& points, double& weight)
+{
+    EdgeLblUGraph<std::size_t, double> g;
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        g.addVertex(i);
+        for (std::size_t j = 0; j < i; ++j)
+        {
+            double d2 = 0;
+            for (std::size_t k = 0; k < Dim; ++k)
+                d2 += (points[i][k] - points[j][k]) * (points[i][k] - points[j][k]);
+            g.addLblEdge(j, i, std::sqrt(d2));
+        }
+    }
+
+    std::set<std::pair<std::size_t, std::size_t> > res = findMSTKruskal(g);
+    weight = 0;
+    for (const std::pair<std::size_t, std::size_t>& e : res)
+    {
+        double lbl = 0;
+        g.getLabel(e.first, e.second, lbl);
+        weight += lbl;
+    }
+
+    return res;
+}
+
+// Makes \a n random points in a unit cube.
+template <std::size_t Dim>
+static std::vector<std::array<double, Dim> > makeRandomPoints(std::size_t n, unsigned seed)
+{
+    std::vector<std::array<double, Dim> > points(n);
+    TestRandom rnd(seed);
+    for (std::array<double, Dim>& p : points)
+    {
+        for (double& x : p)
+            x = rnd.next(100000) / 100000.0;
+    }
+
+    return points;
+}
+
+TEST(EuclideanMST, simple)
+{
+    std::vector<std::array<double, 2> > points = {{{0, 0}}, {{3, 4}}, {{3, 0}}, {{10, 0}}};
+    MSTEdges<std::size_t, double> res = findEuclideanMST(points);
+    ASSERT_EQ(3, res.edges.size());
+    EXPECT_DOUBLE_EQ(3 + 4 + 7, res.weight);
+    EXPECT_EQ((std::set<std::pair<std::size_t, std::size_t> >{{0, 2}, {1, 2}, {2, 3}}),
+              getEdgeSet(res));
+
+    EXPECT_TRUE(findEuclideanMST(std::vector<std::array<double, 2> >()).edges.empty());
+    EXPECT_TRUE(findEuclideanMST(std::vector<std::array<double, 2> >(1)).edges.empty());
+
+    points[1][0] = NAN;
+    EXPECT_THROW(findEuclideanMST(points), std::invalid_argument);
+}
+
+
+// Tests random points in 2-D and 3-D against the complete graph.
+TEST(EuclideanMST, sameAsCompleteGraph)
+{
+    for (std::size_t n : {2, 9, 50, 200})
+    {
+        std::vector<std::array<double, 2> > points2 = makeRandomPoints<2>(n, 3);
+        double weight = 0;
+        EXPECT_EQ(findCompleteGraphMST(points2, weight), getEdgeSet(findEuclideanMST(points2)));
+        EXPECT_NEAR(weight, findEuclideanMST(points2).weight, 1e-9);
+
+        std::vector<std::array<double, 3> > points3 = makeRandomPoints<3>(n, 8);
+        EXPECT_EQ(findCompleteGraphMST(points3, weight), getEdgeSet(findEuclideanMST(points3)));
+        EXPECT_NEAR(weight, findEuclideanMST(points3).weight, 1e-9);
+    }
+}
+
+
+// Tests a grid with many equal distances and duplicate points.
+TEST(EuclideanMST, ties)
+{
+    std::vector<std::array<double, 2> > points;
+    for (int x = 0; x < 12; ++x)
+        for (int y = 0; y < 10; ++y)
+            points.push_back({{double(x), double(y)}});
+    points.push_back({{3, 3}});
+    points.push_back({{3, 3}});
+
+    double weight = 0;
+    EXPECT_EQ(findCompleteGraphMST(points, weight), getEdgeSet(findEuclideanMST(points)));
+    EXPECT_DOUBLE_EQ(119, weight);
+    EXPECT_DOUBLE_EQ(119, findEuclideanMST(points).weight);
+}
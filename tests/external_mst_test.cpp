@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the out-of-core MST.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <dirent.h>
+#endif
+
+#include "ugraph/external_mst.hpp"
+#include "ugraph/csr_file.hpp"
+#include "test_graphs.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef ExternalMST<int, int> IntIntExternalMST;
+
+// Work directory used by these tests only.
+const std::string WORK_DIR = GV_OUT_DIR "external_mst";
+
+
+// Makes the work directory if there is none and removes all files from it, so
+// a test doesn't see files left by a failed one.
+static void clearWorkDir()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    mkdir(WORK_DIR.c_str(), 0777);
+    if (DIR* dir = opendir(WORK_DIR.c_str()))
+    {
+        while (const dirent* e = readdir(dir))
+        {
+            const std::string name = e->d_name;
+            if (name != "." && name != "..")
+                std::remove((WORK_DIR + "/" + name).c_str());
+        }
+        closedir(dir);
+    }
+#endif
+}
+
+
+// Writes the labeled edges of the graph \a g as a text edge list.
+static std::string makeEdgesText(const IntIntGraph& g)
+{
+    std::ostringstream out;
+    IntIntGraph::EdgeLabelingCIterPair range = g.getLblEdges();
+    for (IntIntGraph::EdgeLabelingCIter it = range.first; it != range.second; ++it)
+        out << it->first.first << ' ' << it->first.second << ' ' << it->second << '\n';
+
+    return out.str();
+}
+
+
+// Tests that many small runs and intermediate merges give the same edges as
+// findMSTKruskal(), for text and CSR input.
+TEST(ExternalMST, sameAsKruskal)
+{
+    IntIntGraph g = makeRandomGraph<IntIntGraph>(700, 4000, 5, 40);  // many equal labels
+    std::string text = makeEdgesText(g);
+    std::set<IntIntGraph::Edge> expected = findMSTKruskal(g);
+
+    clearWorkDir();
+    IntIntExternalMST mst(WORK_DIR, 100, 3);
+    std::istringstream in(text);
+    mst.readEdges(in);
+    MSTEdges<int, int> res = mst.finish();
+    EXPECT_GE(3, mst.getRunsNum());
+    EXPECT_EQ(g.getEdgesNum(), mst.getConsumedNum());
+    EXPECT_EQ(expected, getEdgeSet(res));
+    EXPECT_EQ(findMSTEdges(g).weight, res.weight);
+    mst.removeFiles();
+    EXPECT_EQ(0, mst.getRunsNum());
+
+    writeCsrSnapshot(WORK_DIR + "/graph.csr", g.freeze());
+    res = findMSTExternal(mapCsrSnapshot<int, int>(WORK_DIR + "/graph.csr"), WORK_DIR, 250);
+    EXPECT_EQ(expected, getEdgeSet(res));
+
+    std::istringstream loops("1 1 5\n2 2 3\n");
+    res = findMSTExternal<int, int>(loops, WORK_DIR, 10);
+    EXPECT_TRUE(res.edges.empty());
+    EXPECT_EQ(0, res.weight);
+}
+
+
+// Tests resuming after a crash in the middle of the input.
+TEST(ExternalMST, resume)
+{
+    IntIntGraph g = makeRandomGraph<IntIntGraph>(700, 3000, 5, 40);
+    std::string text = makeEdgesText(g);
+    std::uint64_t consumed = 0;
+    clearWorkDir();
+    {
+        IntIntExternalMST mst(WORK_DIR, 200);
+        std::istringstream in(text);
+        int s, d, lbl;
+        for (int i = 0; i < 1500 && in >> s >> d >> lbl; ++i)
+            mst.addEdge(s, d, lbl);
+        consumed = mst.getConsumedNum();
+        EXPECT_LT(consumed, 1500);                  // the last chunk is lost
+    }
+
+    IntIntExternalMST mst(WORK_DIR, 200);
+    EXPECT_EQ(7, mst.getRunsNum());
+    EXPECT_EQ(consumed, mst.getSkipNum());
+    std::istringstream in(text);
+    mst.readEdges(in);
+    EXPECT_EQ(0, mst.getSkipNum());
+    EXPECT_EQ(findMSTKruskal(g), getEdgeSet(mst.finish()));
+    mst.removeFiles();
+}
+
+
+// Tests invalid parameters and manifests.
+TEST(ExternalMST, errors)
+{
+    clearWorkDir();
+    EXPECT_THROW(IntIntExternalMST(WORK_DIR, 0), std::invalid_argument);
+    EXPECT_THROW(IntIntExternalMST(WORK_DIR, 10, 1), std::invalid_argument);
+
+    {
+        std::ofstream f((WORK_DIR + "/manifest").c_str());
+        f << "UGREXTMST 2 4 s 4 s\nconsumed x\n";
+    }
+    EXPECT_THROW(IntIntExternalMST(WORK_DIR, 10), std::invalid_argument);
+    {
+        std::ofstream f((WORK_DIR + "/manifest").c_str());
+        f << "UGREXTMST 2 4 s 8 s\nconsumed 0\nnext 0\n";
+    }
+    EXPECT_THROW(IntIntExternalMST(WORK_DIR, 10), std::invalid_argument);
+
+    // a run listed in the manifest is missing
+    {
+        std::ofstream f((WORK_DIR + "/manifest").c_str());
+        f << "UGREXTMST 2 4 s 4 s\nconsumed 10\nnext 100\nrun 99 3\n";
+    }
+    IntIntExternalMST mst(WORK_DIR, 10);
+    EXPECT_THROW(mst.finish(), std::runtime_error);
+    mst.removeFiles();
+
+    // the old format without kinds of types is not resumed
+    {
+        std::ofstream f((WORK_DIR + "/manifest").c_str());
+        f << "UGREXTMST 1 4 4\nconsumed 0\nnext 0\n";
+    }
+    EXPECT_THROW(IntIntExternalMST(WORK_DIR, 10), std::invalid_argument);
+}
+
+
+// Tests that runs of integer labels are not resumed as runs of floating point
+// labels of the same size.
+TEST(ExternalMST, otherTypes)
+{
+    clearWorkDir();
+    {
+        IntIntExternalMST mst(WORK_DIR, 2);
+        std::istringstream in("1 2 5\n2 3 4\n3 4 3\n");
+        mst.readEdges(in);
+        EXPECT_LT(0, mst.getRunsNum());
+    }
+
+    static_assert(sizeof(float) == sizeof(int), "Labels must be of the same size");
+    EXPECT_THROW((ExternalMST<int, float>(WORK_DIR, 2)), std::invalid_argument);
+    EXPECT_THROW((ExternalMST<int, unsigned>(WORK_DIR, 2)), std::invalid_argument);
+    EXPECT_THROW((ExternalMST<unsigned, int>(WORK_DIR, 2)), std::invalid_argument);
+
+    IntIntExternalMST mst(WORK_DIR, 2);
+    EXPECT_EQ(1, mst.getRunsNum());
+    mst.removeFiles();
+}
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for Prim's algorithm on implicit complete graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "ugraph/implicit_mst.hpp"
+#include "test_graphs.hpp"
+
+
+typedef std::set<std::pair<VertexId, VertexId> > EdgeSet;
+
+
+/// Cosine distances between rows of a feature matrix; evaluates blocks.
+struct CosineDistance {
+    std::vector<float> features;            ///< Normalized rows.
+    std::size_t dim;                        ///< Length of a row.
+
+    float operator()(VertexId u, VertexId v) const
+    {
+        float dot = 0;
+        for (std::size_t k = 0; k < dim; ++k)
+            dot += features[u * dim + k] * features[v * dim + k];
+
+        return 1 - dot;
+    }
+
+    void operator()(VertexId u, const VertexId* vs, std::size_t n, float* out) const
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            out[i] = (*this)(u, vs[i]);
+    }
+};
+
+// Makes \a n random normalized rows of \a dim features.
+static CosineDistance makeCosineDistance(std::size_t n, std::size_t dim)
+{
+    CosineDistance f;
+    f.dim = dim;
+    f.features.resize(n * dim);
+    TestRandom rnd(17);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        float norm = 0;
+        for (std::size_t k = 0; k < dim; ++k)
+        {
+            float x = rnd.next(1000) / 1000.0f - 0.5f;
+            f.features[i * dim + k] = x;
+            norm += x * x;
+        }
+        for (std::size_t k = 0; k < dim; ++k)
+            f.features[i * dim + k] /= std::sqrt(norm);
+    }
+
+    return f;
+}
+
+// Finds a MST of the complete graph made by the weight function \a f.
+template <typename EdgeLbl, typename F>
+static EdgeSet findCompleteGraphMST(std::size_t n, F f)
+{
+    EdgeLblUGraph<VertexId, EdgeLbl> g;
+    for (VertexId u = 0; u < n; ++u)
+    {
+        g.addVertex(u);
+        for (VertexId v = 0; v < u; ++v)
+        {
+            if (f(v, u) < WeightTraits<EdgeLbl>::infinity())
+                g.addLblEdge(v, u, f(v, u));
+        }
+    }
+
+    return findMSTPrim(g);
+}
+
+TEST(ImplicitMST, simple)
+{
+    // vertices on a line; |u - v| ^ 2
+    auto line = [](VertexId u, VertexId v)
+    {
+        int d = static_cast<int>(u) - static_cast<int>(v);
+        return d * d;
+    };
+    MSTEdges<VertexId, int> res = findMSTImplicit<int>(5, line);
+    EXPECT_EQ(4, res.weight);
+    EXPECT_EQ((EdgeSet{{0, 1}, {1, 2}, {2, 3}, {3, 4}}), getEdgeSet(res));
+
+    EXPECT_TRUE(findMSTImplicit<int>(0, line).edges.empty());
+    EXPECT_TRUE(findMSTImplicit<int>(1, line).edges.empty());
+
+    // absent edges make a forest
+    auto parity = [](VertexId u, VertexId v)
+    {
+        return (u - v) % 2 ? WeightTraits<int>::infinity() : static_cast<int>(u + v);
+    };
+    res = findMSTImplicit<int>(6, parity);
+    EXPECT_EQ(findCompleteGraphMST<int>(6, parity), getEdgeSet(res));
+    EXPECT_EQ(4, res.edges.size());
+}
+
+
+// Tests single and block weight functions with and without a pool against the
+// complete graph.
+TEST(ImplicitMST, sameAsPrim)
+{
+    const std::size_t n = 300;
+    CosineDistance cosine = makeCosineDistance(n, 16);
+    auto single = [&cosine](VertexId u, VertexId v) { return cosine(u, v); };
+    static_assert(HasBlockWeights<CosineDistance, float>::value, "Block weights");
+    static_assert(!HasBlockWeights<decltype(single), float>::value, "Single weights");
+
+    const EdgeSet expected = findCompleteGraphMST<float>(n, single);
+    MSTEdges<VertexId, float> res = findMSTImplicit<float>(n, single);
+    EXPECT_EQ(expected, getEdgeSet(res));
+    EXPECT_EQ(expected, getEdgeSet(findMSTImplicit<float>(n, cosine)));
+
+    WorkStealingPool pool(3);
+    for (std::size_t minGrain : {1, 16, 100})
+    {
+        MSTEdges<VertexId, float> par = findMSTImplicit<float>(n, cosine, &pool, minGrain);
+        ASSERT_EQ(res.edges.size(), par.edges.size());
+        for (std::size_t i = 0; i < par.edges.size(); ++i)
+        {
+            EXPECT_EQ(res.edges[i].s, par.edges[i].s);
+            EXPECT_EQ(res.edges[i].d, par.edges[i].d);
+        }
+        EXPECT_EQ(res.weight, par.weight);
+    }
+}
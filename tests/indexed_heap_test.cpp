@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the indexed d-ary heap.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <algorithm>
+
+#include "ugraph/indexed_heap.hpp"
+#include "test_graphs.hpp"
+
+
+typedef IndexedDaryHeap<int> IntHeap;
+typedef IndexedDaryHeap<int, 2> IntBinaryHeap;
+
+
+TEST(IndexedDaryHeap, empty)
+{
+    IntHeap h(10);
+    EXPECT_TRUE(h.isEmpty());
+    EXPECT_EQ(0, h.getSize());
+    EXPECT_EQ(10, h.getCapacity());
+    EXPECT_FALSE(h.contains(3));
+    EXPECT_FALSE(h.contains(100));
+}
+
+TEST(IndexedDaryHeap, insertExtract)
+{
+    IntHeap h(5);
+    h.insert(0, 50);
+    h.insert(1, 10);
+    h.insert(2, 30);
+    h.insert(3, 20);
+    h.insert(4, 40);
+    EXPECT_EQ(5, h.getSize());
+    EXPECT_TRUE(h.contains(2));
+    EXPECT_EQ(30, h.getKey(2));
+
+    EXPECT_THROW(h.insert(2, 1), std::invalid_argument);
+    EXPECT_THROW(h.insert(5, 1), std::out_of_range);
+
+    std::vector<IntHeap::Handle> order;
+    while(!h.isEmpty())
+        order.push_back(h.extractMin());
+
+    std::vector<IntHeap::Handle> expected = {1, 3, 2, 4, 0};
+    EXPECT_EQ(expected, order);
+    EXPECT_FALSE(h.contains(2));
+}
+
+TEST(IndexedDaryHeap, decreaseKey)
+{
+    IntBinaryHeap h(4);
+    h.insert(0, 10);
+    h.insert(1, 20);
+    h.insert(2, 30);
+
+    EXPECT_FALSE(h.decreaseKey(1, 25));
+    EXPECT_EQ(20, h.getKey(1));
+
+    EXPECT_TRUE(h.decreaseKey(2, 5));
+    EXPECT_EQ(2, h.getMin());
+    EXPECT_EQ(5, h.getMinKey());
+
+    EXPECT_TRUE(h.insertOrDecrease(3, 1));
+    EXPECT_EQ(3, h.getMin());
+    EXPECT_FALSE(h.insertOrDecrease(3, 2));
+
+    h.remove(3);
+    h.remove(3);
+    EXPECT_EQ(2, h.extractMin());
+    EXPECT_EQ(0, h.extractMin());
+    EXPECT_EQ(1, h.extractMin());
+    EXPECT_TRUE(h.isEmpty());
+}
+
+// Compares the heap with sorting on a pseudo-random sequence of operations.
+TEST(IndexedDaryHeap, randomized)
+{
+    const std::size_t n = 1000;
+    IndexedDaryHeap<unsigned, 8> h(n);
+    std::vector<unsigned> keys(n);
+
+    TestRandom rnd(12345);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        keys[i] = rnd.next() % 100000;
+        h.insert(i, keys[i]);
+    }
+    for(std::size_t i = 0; i < n; i += 3)
+    {
+        keys[i] /= 2;
+        h.decreaseKey(i, keys[i]);
+    }
+
+    std::vector<unsigned> extracted;
+    while(!h.isEmpty())
+    {
+        extracted.push_back(h.getMinKey());
+        h.extractMin();
+    }
+
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(keys, extracted);
+
+    // reuse after clearing
+    h.insert(7, 1);
+    h.clear();
+    EXPECT_TRUE(h.isEmpty());
+    EXPECT_FALSE(h.contains(7));
+}
@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
+
 #include "ugraph/lbl_ugraph.hpp"
 
 
@@ -59,3 +61,227 @@ TEST(EdgeLblUGraph, getEdgeLabel)
 }
 
 
+
+// Tests making a CSR snapshot of a graph w/ self-loops and unlabeled edges.
+TEST(EdgeLblUGraph, freeze)
+{
+    IntIntGraph g;
+    g.addLblEdge(3, 1, 20);
+    g.addLblEdge(1, 2, 10);
+    g.addEdge(1, 4);
+    g.addLblEdge(2, 2, 5);
+    g.addLblEdge(2, 4, 40);
+    g.addVertex(7);
+
+    IntIntGraph::Snapshot sn = g.freeze();
+    g.addLblEdge(7, 1, 70);         // snapshot doesn't depend on the graph
+
+    EXPECT_EQ(5, sn.getVerticesNum());
+    EXPECT_EQ(5, sn.getEdgesNum());
+    EXPECT_TRUE(sn.isVertexExists(7));
+    EXPECT_FALSE(sn.isVertexExists(5));
+
+    IntIntGraph::Snapshot::VertexId id;
+    ASSERT_TRUE(sn.findVertexId(4, id));
+    EXPECT_EQ(3, id);
+    EXPECT_EQ(4, sn.getVertex(id));
+    EXPECT_EQ(2, sn.getDegree(id));
+
+    // neighbours of 1 are sorted: 2, 3, 4
+    ASSERT_TRUE(sn.findVertexId(1, id));
+    IntIntGraph::Snapshot::AdjCIterPair adj = sn.getAdjEdges(id);
+    ASSERT_EQ(3, adj.second - adj.first);
+    EXPECT_EQ(2, sn.getVertex(adj.first[0].vertex));
+    EXPECT_EQ(10, adj.first[0].lbl);
+    EXPECT_EQ(3, sn.getVertex(adj.first[1].vertex));
+    EXPECT_EQ(20, adj.first[1].lbl);
+    EXPECT_EQ(4, sn.getVertex(adj.first[2].vertex));
+    EXPECT_FALSE(adj.first[2].hasLbl);
+
+    int lbl;
+    EXPECT_TRUE(sn.getLabel(4, 2, lbl));
+    EXPECT_EQ(40, lbl);
+    EXPECT_TRUE(sn.getLabel(2, 2, lbl));
+    EXPECT_EQ(5, lbl);
+    EXPECT_FALSE(sn.getLabel(1, 4, lbl));
+    EXPECT_FALSE(sn.getLabel(1, 7, lbl));
+    EXPECT_FALSE(sn.getLabel(1, 5, lbl));
+
+    IntIntGraph::Snapshot empty = IntIntGraph().freeze();
+    EXPECT_EQ(0, empty.getVerticesNum());
+    EXPECT_EQ(0, empty.getEdgesNum());
+}
+
+
+
+// Tests bulk addition of labeled edges w/ duplicates and existing edges.
+TEST(EdgeLblUGraph, addLblEdges)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 10);
+    g.addEdge(1, 4);
+
+    std::vector<IntIntGraph::LblEdgeTuple> batch = {
+        IntIntGraph::LblEdgeTuple(3, 1, 20),
+        IntIntGraph::LblEdgeTuple(2, 1, 11),    // updates {1, 2}
+        IntIntGraph::LblEdgeTuple(4, 1, 40),    // labels {1, 4}
+        IntIntGraph::LblEdgeTuple(1, 3, 21),    // the last one wins
+        IntIntGraph::LblEdgeTuple(5, 5, 50),
+        IntIntGraph::LblEdgeTuple(6, 2, 60),
+    };
+    g.addLblEdges(batch.begin(), batch.end());
+
+    EXPECT_EQ(6, g.getVerticesNum());
+    EXPECT_EQ(5, g.getEdgesNum());
+
+    int lbl;
+    EXPECT_TRUE(g.getLabel(1, 2, lbl));
+    EXPECT_EQ(11, lbl);
+    EXPECT_TRUE(g.getLabel(1, 3, lbl));
+    EXPECT_EQ(21, lbl);
+    EXPECT_TRUE(g.getLabel(1, 4, lbl));
+    EXPECT_EQ(40, lbl);
+    EXPECT_TRUE(g.getLabel(5, 5, lbl));
+    EXPECT_EQ(50, lbl);
+    EXPECT_TRUE(g.getLabel(2, 6, lbl));
+    EXPECT_EQ(60, lbl);
+
+    // the adjacency is the same as after adding edges one by one
+    EXPECT_EQ(3, std::distance(g.getAdjEdges(1).first, g.getAdjEdges(1).second));
+    EXPECT_EQ(2, std::distance(g.getAdjEdges(5).first, g.getAdjEdges(5).second));
+    EXPECT_TRUE(g.isEdgeExists(6, 2));
+
+    g.addLblEdges(batch.end(), batch.end());
+    EXPECT_EQ(5, g.getEdgesNum());
+}
+
+
+
+// Tests labeled adjacency lists kept along w/ labels.
+TEST(EdgeLblUGraph, getLblAdjEdges)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 10);
+    g.addLblEdge(3, 1, 20);
+    g.addEdge(1, 4);
+    g.addLblEdge(2, 2, 5);
+
+    std::vector<IntIntGraph::LblEdgeTuple> batch = {
+        IntIntGraph::LblEdgeTuple(2, 1, 11),    // updates {1, 2}
+        IntIntGraph::LblEdgeTuple(4, 1, 40),    // labels {1, 4}
+        IntIntGraph::LblEdgeTuple(2, 2, 6),
+    };
+    g.addLblEdges(batch.begin(), batch.end());
+
+    std::map<int, int> adj;
+    IntIntGraph::LblAdjListCIterPair range = g.getLblAdjEdges(1);
+    for (IntIntGraph::LblAdjListCIter it = range.first; it != range.second; ++it)
+        adj[it->second.vertex] = it->second.lbl;
+
+    EXPECT_EQ((std::map<int, int>{{2, 11}, {3, 20}, {4, 40}}), adj);
+
+    range = g.getLblAdjEdges(2);
+    ASSERT_EQ(3, std::distance(range.first, range.second));
+    for (IntIntGraph::LblAdjListCIter it = range.first; it != range.second; ++it)
+        EXPECT_EQ(it->second.vertex == 1 ? 11 : 6, it->second.lbl);
+
+    range = g.getLblAdjEdges(5);
+    EXPECT_EQ(range.first, range.second);
+
+    // labels of the snapshot come from the labeled adjacency
+    IntIntGraph::Snapshot sn = g.freeze();
+    int lbl;
+    EXPECT_TRUE(sn.getLabel(4, 1, lbl));
+    EXPECT_EQ(40, lbl);
+    EXPECT_TRUE(sn.getLabel(2, 2, lbl));
+    EXPECT_EQ(6, lbl);
+}
+
+// Tests that adding a labeled edge again updates its label everywhere.
+TEST(EdgeLblUGraph, updateLabel)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 10);
+    g.addLblEdge(3, 3, 5);
+    g.addEdge(1, 4);
+
+    g.addLblEdge(2, 1, 12);
+    g.addLblEdge(3, 3, 6);
+    g.addLblEdge(4, 1, 40);                         // labels an unlabeled edge
+    EXPECT_EQ(3, g.getEdgesNum());
+
+    int lbl;
+    EXPECT_TRUE(g.getLabel(1, 2, lbl));
+    EXPECT_EQ(12, lbl);
+    EXPECT_TRUE(g.getLabel(1, 4, lbl));
+    EXPECT_EQ(40, lbl);
+
+    IntIntGraph::LblAdjListCIterPair range = g.getLblAdjEdges(2);
+    ASSERT_EQ(1, std::distance(range.first, range.second));
+    EXPECT_EQ(12, range.first->second.lbl);
+    range = g.getLblAdjEdges(3);
+    ASSERT_EQ(2, std::distance(range.first, range.second));
+    for (IntIntGraph::LblAdjListCIter it = range.first; it != range.second; ++it)
+        EXPECT_EQ(6, it->second.lbl);
+
+    IntIntGraph::Snapshot sn = g.freeze();
+    EXPECT_TRUE(sn.getLabel(2, 1, lbl));
+    EXPECT_EQ(12, lbl);
+}
+
+// Tests removing labeled and unlabeled edges.
+TEST(EdgeLblUGraph, removeEdge)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 10);
+    g.addLblEdge(1, 3, 20);
+    g.addLblEdge(3, 3, 5);
+    g.addEdge(1, 4);
+
+    EXPECT_TRUE(g.removeEdge(2, 1));
+    EXPECT_TRUE(g.removeEdge(3, 3));
+    EXPECT_TRUE(g.removeEdge(1, 4));
+    EXPECT_FALSE(g.removeEdge(1, 4));
+    EXPECT_EQ(1, g.getEdgesNum());
+    EXPECT_EQ(4, g.getVerticesNum());
+
+    int lbl;
+    EXPECT_FALSE(g.getLabel(1, 2, lbl));
+    EXPECT_TRUE(g.getLabel(3, 1, lbl));
+    EXPECT_EQ(1, std::distance(g.getLblEdges().first, g.getLblEdges().second));
+
+    IntIntGraph::LblAdjListCIterPair range = g.getLblAdjEdges(1);
+    ASSERT_EQ(1, std::distance(range.first, range.second));
+    EXPECT_EQ(3, range.first->second.vertex);
+    range = g.getLblAdjEdges(3);
+    ASSERT_EQ(1, std::distance(range.first, range.second));
+    EXPECT_EQ(1, range.first->second.vertex);
+
+    g.addLblEdge(1, 2, 7);                          // added back
+    EXPECT_TRUE(g.getLabel(2, 1, lbl));
+    EXPECT_EQ(7, lbl);
+    EXPECT_EQ(2, g.freeze().getEdgesNum());
+}
+
+
+// Labels can't go stale by changing a graph through its unlabeled base.
+TEST(EdgeLblUGraph, changeThroughBase)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 5);
+    g.addLblEdge(2, 3, 7);
+
+    UGraph<int>& base = g;
+    EXPECT_TRUE(base.removeEdge(2, 1));
+    EXPECT_FALSE(base.removeEdge(1, 2));
+    base.addEdge(1, 2);                             // comes back unlabeled
+
+    int lbl = 0;
+    EXPECT_FALSE(g.getLabel(1, 2, lbl));
+    EXPECT_EQ(1, std::distance(g.getLblEdges().first, g.getLblEdges().second));
+    EXPECT_EQ(0, std::distance(g.getLblAdjEdges(1).first, g.getLblAdjEdges(1).second));
+    EXPECT_EQ(1, std::distance(g.getLblAdjEdges(2).first, g.getLblAdjEdges(2).second));
+
+    const VertexIndex<int> index(g);
+    EXPECT_EQ(3, index.getSize());
+}
@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the link-cut tree.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include "ugraph/link_cut_tree.hpp"
+#include "test_graphs.hpp"
+
+
+typedef LinkCutTree<int> IntLct;
+
+
+TEST(LinkCutTree, linkCut)
+{
+    IntLct t;
+    IntLct::Node a = t.addNode();
+    IntLct::Node b = t.addNode();
+    IntLct::Node c = t.addNode();
+    IntLct::Node ab = t.addNode(5);
+    IntLct::Node bc = t.addNode(3);
+    EXPECT_EQ(5, t.getSize());
+    EXPECT_FALSE(t.hasKey(a));
+    EXPECT_TRUE(t.hasKey(ab));
+    EXPECT_EQ(5, t.getKey(ab));
+
+    EXPECT_FALSE(t.isConnected(a, c));
+    EXPECT_EQ(IntLct::NoNode, t.findPathMax(a, c));
+    t.link(ab, a);
+    t.link(ab, b);
+    t.link(bc, b);
+    t.link(bc, c);
+    EXPECT_TRUE(t.isConnected(a, c));
+    EXPECT_EQ(ab, t.findPathMax(c, a));
+    EXPECT_EQ(bc, t.findPathMax(b, c));
+    EXPECT_EQ(IntLct::NoNode, t.findPathMax(b, b));
+    EXPECT_THROW(t.link(a, c), std::invalid_argument);
+    EXPECT_THROW(t.cut(a, c), std::invalid_argument);
+
+    t.cut(b, ab);
+    EXPECT_FALSE(t.isConnected(a, c));
+    EXPECT_TRUE(t.isConnected(a, ab));
+    EXPECT_TRUE(t.isConnected(b, c));
+
+    t.cut(ab, a);
+    t.removeNode(ab);
+    EXPECT_EQ(4, t.getSize());
+    IntLct::Node ac = t.addNode(1);
+    EXPECT_EQ(ab, ac);                              // the id is reused
+    t.link(a, ac);
+    t.link(c, ac);
+    EXPECT_EQ(bc, t.findPathMax(a, b));
+
+    t.setKey(bc, 0);
+    EXPECT_EQ(ac, t.findPathMax(a, b));
+    t.setKey(ac, -1);
+    EXPECT_EQ(bc, t.findPathMax(b, a));
+    EXPECT_EQ(-1, t.getKey(ac));
+}
+
+// Compares path maximums and connectivity w/ a naive forest on random links
+// and cuts.
+TEST(LinkCutTree, random)
+{
+    const int n = 60;
+    IntLct t;
+    for(int i = 0; i < n; ++i)
+        t.addNode(i * 37 % n);
+
+    std::vector<std::vector<int> > adj(n);
+    std::vector<std::pair<int, int> > edges;
+
+    // returns the path from x to y or an empty one
+    auto findPath = [&](int x, int y)
+    {
+        std::vector<int> prev(n, -1);
+        std::vector<int> queue(1, x);
+        prev[x] = x;
+        for(std::size_t i = 0; i < queue.size(); ++i)
+            for(int z : adj[queue[i]])
+                if(prev[z] < 0)
+                {
+                    prev[z] = queue[i];
+                    queue.push_back(z);
+                }
+
+        std::vector<int> path;
+        if(prev[y] < 0)
+            return path;
+        for(int z = y; z != x; z = prev[z])
+            path.push_back(z);
+        path.push_back(x);
+        return path;
+    };
+
+    TestRandom rnd(17);
+    for(int step = 0; step < 3000; ++step)
+    {
+        int x = rnd.next(n);
+        int y = rnd.next(n);
+        std::vector<int> path = findPath(x, y);
+
+        ASSERT_EQ(!path.empty(), t.isConnected(x, y));
+        if(!path.empty())
+        {
+            int heaviest = path[0];
+            for(int z : path)
+                if(t.getKey(z) > t.getKey(heaviest))
+                    heaviest = z;
+            EXPECT_EQ(heaviest, t.findPathMax(x, y));
+        }
+
+        if(path.empty())
+        {
+            t.link(x, y);
+            adj[x].push_back(y);
+            adj[y].push_back(x);
+            edges.push_back(std::make_pair(x, y));
+        }
+        else if(rnd.getLast() % 3 == 0 && !edges.empty())
+        {
+            std::pair<int, int> e = edges[rnd.getLast() % edges.size()];
+            t.cut(e.second, e.first);
+            adj[e.first].erase(std::find(adj[e.first].begin(), adj[e.first].end(), e.second));
+            adj[e.second].erase(std::find(adj[e.second].begin(), adj[e.second].end(), e.first));
+            edges.erase(std::find(edges.begin(), edges.end(), e));
+        }
+    }
+}
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the choice of MST engines.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "ugraph/mst_dispatch.hpp"
+#include "test_graphs.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+
+
+// Tests the choice by the shape of graphs w/ explicit thresholds.
+TEST(MSTDispatch, chooseEngine)
+{
+    MSTCalibration c;
+    c.denseDensityGraph = 0.1;
+    c.denseDensitySnapshot = 0.5;
+    c.denseScalarFactor = 2;
+    c.kruskalMaxDegreeGraph = 16;
+    c.kruskalMaxDegreeSnapshot = 0;
+    c.parallelMinEdges = 1000000;
+
+    // 1000 vertices have 499500 pairs
+    EXPECT_EQ(MSTEngine::PrimDense, chooseMSTEngine(1000, 60000, false, true, 1, c));
+    EXPECT_EQ(MSTEngine::PrimHeap, chooseMSTEngine(1000, 60000, true, true, 1, c));
+    EXPECT_EQ(MSTEngine::PrimDense, chooseMSTEngine(1000, 300000, true, true, 1, c));
+    EXPECT_EQ(MSTEngine::PrimHeap, chooseMSTEngine(1000, 300000, true, false, 1, c));
+    EXPECT_EQ(MSTEngine::Kruskal, chooseMSTEngine(1000, 8000, false, true, 1, c));
+    EXPECT_EQ(MSTEngine::PrimHeap, chooseMSTEngine(1000, 8000, true, true, 1, c));
+    EXPECT_EQ(MSTEngine::Kruskal, chooseMSTEngine(1000000, 2000000, false, true, 1, c));
+    EXPECT_EQ(MSTEngine::Boruvka, chooseMSTEngine(1000000, 2000000, false, true, 8, c));
+    EXPECT_EQ(MSTEngine::PrimHeap, chooseMSTEngine(1, 0, false, true, 8, c));
+
+    // Borůvka is not chosen by default
+    EXPECT_EQ(MSTEngine::Kruskal,
+              chooseMSTEngine(1000000, 2000000, false, true, 8, MSTCalibration()));
+}
+
+
+// Tests writing and reading calibration files.
+TEST(MSTDispatch, calibrationFile)
+{
+    MSTCalibration c;
+    c.denseDensityGraph = 0.125;
+    c.kruskalMaxDegreeSnapshot = 3.5;
+    c.parallelMinEdges = 12345;
+
+    std::stringstream ss;
+    writeMSTCalibration(ss, c);
+    MSTCalibration r = readMSTCalibration(ss);
+    EXPECT_EQ(0.125, r.denseDensityGraph);
+    EXPECT_EQ(c.denseDensitySnapshot, r.denseDensitySnapshot);
+    EXPECT_EQ(3.5, r.kruskalMaxDegreeSnapshot);
+    EXPECT_EQ(12345, r.parallelMinEdges);
+
+    std::istringstream partial("# measured by hand\n\nkruskal_max_degree_graph 4\n");
+    r = readMSTCalibration(partial);
+    EXPECT_EQ(4, r.kruskalMaxDegreeGraph);
+    EXPECT_EQ(MSTCalibration().parallelMinEdges, r.parallelMinEdges);
+
+    std::istringstream unknown("dense_density 0.5\n");
+    EXPECT_THROW(readMSTCalibration(unknown), std::invalid_argument);
+    std::istringstream malformed("parallel_min_edges many\n");
+    EXPECT_THROW(readMSTCalibration(malformed), std::invalid_argument);
+}
+
+
+// Tests that every engine gives the same MST through the front door.
+TEST(MSTDispatch, findMST)
+{
+    IntIntGraph g = makeRandomGraph<IntIntGraph>(300, 3000, 7);   // distinct labels
+    IntIntGraph::Snapshot sn = g.freeze();
+    std::set<IntIntGraph::Edge> expected = findMSTKruskal(g);
+
+    WorkStealingPool pool(2);
+    MSTOptions opts;
+    opts.pool = &pool;
+    EXPECT_EQ(expected, findMST(g, opts));
+    EXPECT_EQ(expected, findMST(sn));
+
+    for(MSTEngine e : {MSTEngine::PrimDense, MSTEngine::PrimHeap, MSTEngine::Kruskal,
+                       MSTEngine::Boruvka})
+    {
+        opts.engine = e;
+        EXPECT_EQ(expected, findMST(g, opts)) << getMSTEngineName(e);
+        EXPECT_EQ(expected, findMST(sn, opts)) << getMSTEngineName(e);
+    }
+
+    opts.pool = nullptr;
+    opts.threadsNum = 2;
+    EXPECT_EQ(2, opts.getAvailableThreads());
+    EXPECT_EQ(expected, findMST(sn, opts));
+    EXPECT_TRUE(findMST(IntIntGraph()).empty());
+}
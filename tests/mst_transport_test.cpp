@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for transports of partitioned algorithms.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ugraph/mst_transport.hpp"
+
+
+// Makes workers that add their numbers to the sums they keep and reply with
+// the sums.
+static std::vector<TransportHandler> makeAdders(int workersNum)
+{
+    std::vector<TransportHandler> workers;
+    for (int w = 0; w < workersNum; ++w)
+    {
+        std::int64_t sum = w;
+        workers.push_back([sum](const TransportMessage& request,
+                                TransportMessage& reply) mutable
+        {
+            std::size_t pos = 0;
+            sum += getMessageValue<std::int64_t>(request, pos);
+            putMessageValue(reply, sum);
+        });
+    }
+
+    return workers;
+}
+
+// Runs two supersteps on the \a transport of three adders.
+template <typename TTransport>
+static void checkAdders(TTransport& transport)
+{
+    ASSERT_EQ(3, transport.getWorkersNum());
+    std::vector<TransportMessage> requests(3), replies;
+    for (int w = 0; w < 3; ++w)
+        putMessageValue<std::int64_t>(requests[w], 10 * w);
+
+    for (int step = 1; step <= 2; ++step)
+    {
+        transport.exchange(requests, replies);
+        ASSERT_EQ(3, replies.size());
+        for (int w = 0; w < 3; ++w)
+        {
+            std::size_t pos = 0;
+            EXPECT_EQ(w + 10 * w * step, getMessageValue<std::int64_t>(replies[w], pos));
+            EXPECT_EQ(replies[w].size(), pos);
+        }
+    }
+}
+
+
+TEST(MSTTransport, messages)
+{
+    TransportMessage m;
+    putMessageValue<std::uint64_t>(m, 7);
+    putMessageValue(m, 2.5);
+    putMessageValue<char>(m, 'x');
+
+    std::size_t pos = 0;
+    EXPECT_EQ(7, getMessageValue<std::uint64_t>(m, pos));
+    EXPECT_EQ(2.5, getMessageValue<double>(m, pos));
+    EXPECT_EQ('x', getMessageValue<char>(m, pos));
+    EXPECT_THROW(getMessageValue<char>(m, pos), std::out_of_range);
+}
+
+
+TEST(MSTTransport, inProcess)
+{
+    InProcessTransport sequential(makeAdders(3));
+    checkAdders(sequential);
+
+    WorkStealingPool pool(2);
+    InProcessTransport parallel(makeAdders(3), &pool);
+    checkAdders(parallel);
+}
+
+
+#ifdef MST_TRANSPORT_USE_FORK
+
+TEST(MSTTransport, processes)
+{
+    ProcessTransport transport(makeAdders(3));
+    checkAdders(transport);
+
+    // a worker failing in its process is reported
+    std::vector<TransportHandler> failing(1, [](const TransportMessage&, TransportMessage&)
+    {
+        throw std::runtime_error("Worker failure");
+    });
+    ProcessTransport broken(failing);
+    std::vector<TransportMessage> requests(1), replies;
+    EXPECT_THROW(broken.exchange(requests, replies), std::runtime_error);
+}
+
+#endif // MST_TRANSPORT_USE_FORK
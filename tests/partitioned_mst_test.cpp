@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the partitioned Borůvka's algorithm.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ugraph/partitioned_mst.hpp"
+#include "test_graphs.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+
+
+// Tests the result on the graph from CLRS.
+TEST(PartitionedMST, simple)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 4);
+    g.addLblEdge(1, 8, 8);
+    g.addLblEdge(2, 8, 11);
+    g.addLblEdge(2, 3, 8);
+    g.addLblEdge(8, 9, 7);
+    g.addLblEdge(8, 7, 1);
+    g.addLblEdge(3, 9, 2);
+    g.addLblEdge(9, 7, 6);
+    g.addLblEdge(3, 4, 7);
+    g.addLblEdge(3, 6, 4);
+    g.addLblEdge(7, 6, 2);
+    g.addLblEdge(4, 6, 14);
+    g.addLblEdge(4, 5, 9);
+    g.addLblEdge(6, 5, 10);
+    g.addLblEdge(10, 11, 3);                        // another component
+
+    for (std::size_t workersNum : {1, 2, 5, 20})
+        EXPECT_EQ(findMSTKruskal(g), findMSTPartitioned(g, workersNum)) << workersNum;
+
+    EXPECT_TRUE(findMSTPartitioned(IntIntGraph(), 3).empty());
+    EXPECT_THROW(findMSTPartitioned(g, 0), std::invalid_argument);
+}
+
+
+// Tests that partitions give the same edges as findMSTPrim() for distinct
+// labels and as findMSTKruskal() for equal ones, on both transports.
+TEST(PartitionedMST, sameAsPrim)
+{
+    IntIntGraph distinct = makeRandomGraph<IntIntGraph>(600, 3000, 13);
+    IntIntGraph ties = makeRandomGraph<IntIntGraph>(600, 3000, 13, 30);
+    std::set<IntIntGraph::Edge> expectedDistinct = findMSTPrim(distinct);
+    std::set<IntIntGraph::Edge> expectedTies = findMSTKruskal(ties);
+
+    for (std::size_t workersNum : {1, 3, 4})
+    {
+        EXPECT_EQ(expectedDistinct, findMSTPartitioned(distinct, workersNum));
+        EXPECT_EQ(expectedDistinct, findMSTPartitioned(distinct.freeze(), workersNum));
+        EXPECT_EQ(expectedTies, findMSTPartitioned(ties, workersNum));
+#ifdef MST_TRANSPORT_USE_FORK
+        EXPECT_EQ(expectedDistinct,
+                  findMSTPartitioned(distinct, workersNum, MSTTransportKind::Processes));
+        EXPECT_EQ(expectedTies,
+                  findMSTPartitioned(ties.freeze(), workersNum, MSTTransportKind::Processes));
+#endif
+    }
+}
+
+
+// Tests that a worker only keeps the ends of its edges and follows the labels
+// of components.
+TEST(PartitionedMST, workerVertices)
+{
+    typedef IdEdge<int> E;
+    BoruvkaPartWorker<int> worker(std::vector<E>{E{100, 900, 5}, E{900, 400, 3},
+                                                 E{100, 400, 7}});
+    EXPECT_EQ(3, worker.getVerticesNum());
+
+    TransportMessage request, reply;
+    putMessageValue<std::uint64_t>(request, 0);
+    worker(request, reply);
+
+    std::size_t pos = 0;
+    ASSERT_EQ(3, getMessageValue<std::uint64_t>(reply, pos));
+    EXPECT_EQ(100, getMessageValue<VertexId>(reply, pos));
+    EXPECT_EQ(400, getMessageValue<VertexId>(reply, pos));
+    EXPECT_EQ(900, getMessageValue<VertexId>(reply, pos));
+    EXPECT_EQ(3, getMessageValue<std::uint64_t>(reply, pos));   // a candidate per vertex
+
+    // {400, 900} joins 400 (local id 1) and 900 (local id 2): only {100, 400}
+    // and {100, 900} leave components, and the lighter one is the best
+    request.clear();
+    putMessageValue<std::uint64_t>(request, 1);
+    putMessageValue<VertexId>(request, 2);
+    putMessageValue<VertexId>(request, 1);
+    reply.clear();
+    worker(request, reply);
+    EXPECT_EQ(2, worker.getEdgesNum());
+
+    pos = 0;
+    EXPECT_EQ(0, getMessageValue<std::uint64_t>(reply, pos));
+    ASSERT_EQ(2, getMessageValue<std::uint64_t>(reply, pos));
+    for (int i = 0; i < 2; ++i)
+    {
+        const E e = getMessageValue<E>(reply, pos);
+        EXPECT_EQ(100, e.s);
+        EXPECT_EQ(900, e.d);
+        EXPECT_EQ(5, e.lbl);
+    }
+
+    request.clear();
+    putMessageValue<std::uint64_t>(request, 1);
+    putMessageValue<VertexId>(request, 3);
+    putMessageValue<VertexId>(request, 0);
+    EXPECT_THROW(worker(request, reply), std::out_of_range);
+}
+
+
+// Tests that the coordinator checks vertices sent by workers.
+TEST(PartitionedMST, wrongWorker)
+{
+    std::vector<TransportHandler> workers;
+    workers.push_back([](const TransportMessage&, TransportMessage& reply)
+    {
+        putMessageValue<std::uint64_t>(reply, 0);
+        putMessageValue<std::uint64_t>(reply, 1);
+        putMessageValue(reply, IdEdge<int>{0, 10, 1});
+    });
+    InProcessTransport transport(std::move(workers));
+
+    EXPECT_THROW((findMSTPartitionedOnTransport<WeightTraits<int>, int>(5, transport)),
+                 std::out_of_range);
+}
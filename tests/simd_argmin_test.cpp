@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the search of the least element of arrays.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cstdint>
+
+#include "ugraph/simd_argmin.hpp"
+
+
+// Compares with a plain scan on arrays of all lengths up to 70 w/ ties.
+TEST(SimdArgMin, ints)
+{
+    std::less<std::int32_t> less;
+    for(std::size_t n = 1; n <= 70; ++n)
+    {
+        std::vector<std::int32_t> keys(n);
+        for(std::size_t i = 0; i < n; ++i)
+            keys[i] = static_cast<std::int32_t>((i * 7919 + n) % 23) - 5;
+
+        std::size_t expected = 0;
+        for(std::size_t i = 1; i < n; ++i)
+            if(keys[i] < keys[expected])
+                expected = i;
+
+        EXPECT_EQ(expected, findArgMin(keys.data(), n, less)) << "n = " << n;
+    }
+
+    std::vector<std::int32_t> keys(40, std::numeric_limits<std::int32_t>::max());
+    EXPECT_EQ(0, findArgMin(keys.data(), keys.size(), less));
+    keys[37] = std::numeric_limits<std::int32_t>::min();
+    EXPECT_EQ(37, findArgMin(keys.data(), keys.size(), less));
+}
+
+
+// Tests that NaNs are the heaviest keys.
+TEST(SimdArgMin, floats)
+{
+    WeightTraits<float>::Compare less;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+
+    std::vector<float> keys(33, inf);
+    keys[0] = nan;
+    keys[20] = nan;
+    EXPECT_EQ(1, findArgMin(keys.data(), keys.size(), less));
+
+    keys[31] = 0.5f;
+    keys[32] = 0.25f;
+    EXPECT_EQ(32, findArgMin(keys.data(), keys.size(), less));
+
+    keys[9] = 0.25f;
+    EXPECT_EQ(9, findArgMin(keys.data(), keys.size(), less));
+
+    std::vector<float> nans(24, nan);
+    EXPECT_EQ(0, findArgMin(nans.data(), nans.size(), less));
+}
+
+
+TEST(SimdArgMin, generic)
+{
+    std::vector<double> keys = {3.0, 1.0, 2.0, 1.0};
+    EXPECT_EQ(1, findArgMin(keys.data(), keys.size(), std::less<double>()));
+    EXPECT_EQ(0, findArgMin(keys.data(), keys.size(), std::greater<double>()));
+}
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for minimum spanning forests grouped by components.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include "ugraph/spanning_forest.hpp"
+#include "test_graphs.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef ForestComponent<int, int> IntIntComponent;
+
+
+// Tests components, their ids and weights on a small graph.
+TEST(SpanningForest, simple)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 5);
+    g.addLblEdge(2, 3, 1);
+    g.addLblEdge(1, 3, 2);
+    g.addLblEdge(10, 11, 7);
+    g.addLblEdge(4, 4, 3);                          // a self-loop
+    g.addVertex(7);
+    g.addEdge(7, 8);                                // an unlabeled edge
+
+    std::vector<IntIntComponent> forest = findSpanningForest(g, 2);
+    ASSERT_EQ(5, forest.size());
+
+    EXPECT_EQ(0, forest[0].id);
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), forest[0].vertices);
+    ASSERT_EQ(2, forest[0].edges.size());
+    EXPECT_EQ(2, forest[0].edges[0].s);
+    EXPECT_EQ(3, forest[0].edges[0].d);
+    EXPECT_EQ(1, forest[0].edges[0].lbl);
+    EXPECT_EQ(1, forest[0].edges[1].s);
+    EXPECT_EQ(3, forest[0].edges[1].d);
+    EXPECT_EQ(3, forest[0].weight);
+
+    EXPECT_EQ(std::vector<int>({4}), forest[1].vertices);
+    EXPECT_TRUE(forest[1].edges.empty());
+    EXPECT_EQ(0, forest[1].weight);
+    EXPECT_EQ(std::vector<int>({7}), forest[2].vertices);
+    EXPECT_EQ(std::vector<int>({8}), forest[3].vertices);
+
+    EXPECT_EQ(4, forest[4].id);
+    EXPECT_EQ(std::vector<int>({10, 11}), forest[4].vertices);
+    EXPECT_EQ(7, forest[4].weight);
+
+    EXPECT_TRUE(findSpanningForest(IntIntGraph()).empty());
+}
+
+
+// Tests that the forest has the same edges as findMSTKruskal() for any pool.
+TEST(SpanningForest, sameAsKruskal)
+{
+    IntIntGraph g = makeRandomGraph<IntIntGraph>(1500, 2000, 11, 50);  // many equal labels
+    IntIntGraph::Snapshot sn = g.freeze();
+    std::set<IntIntGraph::Edge> expected = findMSTKruskal(g);
+
+    for(std::size_t threadsNum : {1, 2, 4})
+    {
+        WorkStealingPool pool(threadsNum);
+        for(const std::vector<IntIntComponent>& forest
+            : {findSpanningForest(g, pool), findSpanningForest(sn, pool)})
+        {
+            std::set<IntIntGraph::Edge> edges;
+            std::size_t verticesNum = 0;
+            for(std::size_t c = 0; c < forest.size(); ++c)
+            {
+                const IntIntComponent& comp = forest[c];
+                EXPECT_EQ(c, comp.id);
+                EXPECT_EQ(comp.vertices.size() - 1, comp.edges.size());
+                if (c > 0)
+                {
+                    EXPECT_LT(forest[c - 1].vertices.front(), comp.vertices.front());
+                }
+
+                int weight = 0;
+                for (const LblEdge<int, int>& e : comp.edges)
+                {
+                    edges.insert(std::make_pair(e.s, e.d));
+                    weight += e.lbl;
+                }
+                EXPECT_EQ(weight, comp.weight);
+                verticesNum += comp.vertices.size();
+            }
+
+            EXPECT_EQ(expected, edges) << threadsNum;
+            EXPECT_EQ(g.getVerticesNum(), verticesNum);
+        }
+    }
+}
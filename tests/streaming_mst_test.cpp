@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the one-pass MST over edge streams.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <fstream>
+
+#include "ugraph/streaming_mst.hpp"
+#include "test_graphs.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef StreamingMST<int, int> IntIntStreamingMST;
+
+
+// Tests eviction of the heaviest edges of cycles, parallel edges and self-loops.
+TEST(StreamingMST, simple)
+{
+    IntIntStreamingMST mst;
+    mst.addEdge(1, 2, 5);
+    mst.addEdge(2, 3, 4);
+    mst.addEdge(3, 3, 1);                           // a self-loop
+    EXPECT_EQ(2, mst.getEdgesNum());
+
+    mst.addEdge(1, 3, 7);                           // the new edge is evicted
+    EXPECT_EQ(2, mst.getEdgesNum());
+    mst.addEdge(3, 1, 2);                           // {1, 2} is evicted
+    mst.addEdge(2, 3, 1);                           // a lighter parallel edge
+    mst.addEdge(10, 11, 6);
+    EXPECT_EQ(3, mst.getEdgesNum());
+    EXPECT_EQ(7, mst.getStreamedNum());
+    EXPECT_EQ(5, mst.getVerticesNum());
+
+    MSTEdges<int, int> res = mst.getMSTEdges();
+    EXPECT_EQ(9, res.weight);
+    std::set<std::tuple<int, int, int>> edges;
+    for (const LblEdge<int, int>& e : res.edges)
+        edges.insert(std::make_tuple(e.s, e.d, e.lbl));
+    EXPECT_EQ((std::set<std::tuple<int, int, int>>{
+                std::make_tuple(1, 3, 2), std::make_tuple(2, 3, 1),
+                std::make_tuple(10, 11, 6)}), edges);
+
+    EXPECT_EQ(0, IntIntStreamingMST().getMSTEdges().weight);
+}
+
+
+// Tests that the forest is the same as one by findMSTKruskal() and that its
+// size does not depend on the number of edges taken.
+TEST(StreamingMST, sameAsKruskal)
+{
+    IntIntGraph g;
+    IntIntStreamingMST mst;
+    forRandomEdges(800, 5000, 7, [&](int s, int d, int i, const TestRandom&)
+    {
+        if (g.isEdgeExists(s, d))
+            return;
+
+        g.addLblEdge(s, d, i);                      // distinct labels
+        mst.addEdge(s, d, i);
+        EXPECT_LE(mst.getEdgesNum(), mst.getVerticesNum());
+    });
+
+    std::set<IntIntGraph::Edge> edges;
+    mst.forEachEdge([&edges](int u, int v, int)
+    {
+        EXPECT_LT(u, v);
+        edges.insert(std::make_pair(u, v));
+    });
+    EXPECT_EQ(findMSTKruskal(g), edges);
+}
+
+
+// Tests reading edges from text streams and files.
+TEST(StreamingMST, readEdges)
+{
+    std::istringstream in("1 2 5\n2 3 4\n1 3 1\n");
+    MSTEdges<int, int> res = findMSTStream<int, int>(in);
+    EXPECT_EQ(2, res.edges.size());
+    EXPECT_EQ(5, res.weight);
+
+    std::istringstream truncated("1 2 5\n2 3\n");
+    EXPECT_THROW((findMSTStream<int, int>(truncated)), std::invalid_argument);
+    std::istringstream garbage("1 2 5\n2 x 3\n");
+    EXPECT_THROW((findMSTStream<int, int>(garbage)), std::invalid_argument);
+
+    const std::string fn = GV_OUT_DIR "edges.txt";
+    {
+        std::ofstream f(fn.c_str());
+        f << "4 5 3 5 6 1\n6 4 2\n";
+    }
+    res = findMSTStream<int, int>(fn);
+    EXPECT_EQ(2, res.edges.size());
+    EXPECT_EQ(3, res.weight);
+
+    EXPECT_THROW((findMSTStream<int, int>(std::string(GV_OUT_DIR "no/such.txt"))),
+                 std::invalid_argument);
+}
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains pseudo-random data and helpers shared by the testing
+///             modules.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TEST_GRAPHS_HPP
+#define TEST_GRAPHS_HPP
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <utility>
+
+#include "ugraph/ugraph_algos.hpp"
+
+
+/*! ****************************************************************************
+ *  \brief The TestRandom class is a seeded linear congruential generator.
+ *
+ *  Unlike the generators of <random> with distributions, it gives the same
+ *  numbers with every compiler, so the expected values of tests stay valid.
+ ******************************************************************************/
+class TestRandom {
+public:
+    /// Creates a generator started with the \a seed.
+    explicit TestRandom(unsigned seed)
+        : _state(seed)
+    {
+    }
+
+    /// Returns the next raw number.
+    unsigned next()
+    {
+        _state = _state * 1103515245u + 12345u;
+        return _state;
+    }
+
+    /// Returns the next number from 0..n-1; low bits of raw numbers are poor,
+    /// so they are dropped.
+    unsigned next(unsigned n) { return (next() >> 8) % n; }
+
+public:
+    // setters/getters
+
+    /// Returns the last raw number.
+    unsigned getLast() const { return _state; }
+
+protected:
+    unsigned _state;                        ///< Last raw number.
+}; // class TestRandom
+
+
+/// \brief Calls \a addEdge(s, d, i, rnd) for \a edgesNum random pairs of
+/// vertices s, d from 0..verticesNum-1, i being the number of a pair.
+///
+/// The generator \a rnd seeded with \a seed is passed to make labels of, e.g.
+/// rnd.getLast() >> 4 for labels with duplicates.
+template <typename TAddEdge>
+void forRandomEdges(int verticesNum, int edgesNum, unsigned seed, TAddEdge addEdge)
+{
+    TestRandom rnd(seed);
+    for (int i = 0; i < edgesNum; ++i)
+    {
+        const int s = static_cast<int>(rnd.next(verticesNum));
+        const int d = static_cast<int>(rnd.next(verticesNum));
+        addEdge(s, d, i, rnd);
+    }
+}
+
+/// \brief Makes a random graph of \a verticesNum vertices and at most
+/// \a edgesNum edges.
+///
+/// If \a lblsNum is 0, the labels are distinct (i * 7919 % edgesNum for the
+/// i-th edge, 7919 is a prime), so the MST is unique; otherwise there are
+/// \a lblsNum labels with many duplicates. A repeated pair relabels an edge.
+template <typename TGraph>
+TGraph makeRandomGraph(int verticesNum, int edgesNum, unsigned seed, int lblsNum = 0)
+{
+    TGraph g;
+    forRandomEdges(verticesNum, edgesNum, seed,
+        [&](int s, int d, int i, const TestRandom& rnd)
+        {
+            g.addLblEdge(s, d, lblsNum == 0 ? i * 7919 % edgesNum
+                                            : static_cast<int>((rnd.getLast() >> 4) % lblsNum));
+        });
+
+    return g;
+}
+
+/// Collects the edges of the MST \a mst into a set checking that they are
+/// normalized and are not self-loops.
+template <typename Vertex, typename EdgeLbl>
+std::set<std::pair<Vertex, Vertex> > getEdgeSet(const MSTEdges<Vertex, EdgeLbl>& mst)
+{
+    std::set<std::pair<Vertex, Vertex> > res;
+    for (const LblEdge<Vertex, EdgeLbl>& e : mst.edges)
+    {
+        EXPECT_TRUE(e.s < e.d);
+        res.insert(std::make_pair(e.s, e.d));
+    }
+
+    return res;
+}
+
+
+
+#endif // TEST_GRAPHS_HPP
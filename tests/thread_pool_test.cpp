@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the work-stealing thread pool.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+
+#include "ugraph/thread_pool.hpp"
+#include "ugraph/disjoint_set.hpp"
+
+
+TEST(WorkStealingPool, parallelFor)
+{
+    WorkStealingPool pool(4);
+    EXPECT_EQ(4, pool.getThreadsNum());
+
+    std::vector<int> v(10000, 0);
+    pool.parallelFor(0, v.size(), 100, [&v](std::size_t from, std::size_t to)
+    {
+        for(std::size_t i = from; i < to; ++i)
+            v[i] += static_cast<int>(i);
+    });
+
+    for(std::size_t i = 0; i < v.size(); ++i)
+        EXPECT_EQ(static_cast<int>(i), v[i]);
+
+    // empty range does nothing
+    pool.parallelFor(5, 5, 1, [](std::size_t, std::size_t) { FAIL(); });
+}
+
+TEST(WorkStealingPool, nested)
+{
+    WorkStealingPool pool(2);
+    std::atomic<int> sum(0);
+    pool.parallelFor(0, 8, 1, [&](std::size_t, std::size_t)
+    {
+        pool.parallelFor(0, 100, 10, [&](std::size_t from, std::size_t to)
+        {
+            sum += static_cast<int>(to - from);
+        });
+    });
+
+    EXPECT_EQ(800, sum.load());
+}
+
+TEST(WorkStealingPool, exception)
+{
+    WorkStealingPool pool(2);
+    EXPECT_THROW(pool.parallelFor(0, 10, 1, [](std::size_t from, std::size_t)
+    {
+        if(from == 7)
+            throw std::runtime_error("task failed");
+    }), std::runtime_error);
+}
+
+TEST(WorkStealingPool, submit)
+{
+    std::atomic<int> done(0);
+    {
+        WorkStealingPool pool(3);
+        for(int i = 0; i < 100; ++i)
+            pool.submit([&done]() { ++done; });
+    }   // the destructor waits for all the tasks
+
+    EXPECT_EQ(100, done.load());
+}
+
+// Unites a long chain concurrently.
+TEST(ConcurrentDisjointSet, parallelUnite)
+{
+    const std::size_t n = 100000;
+    ConcurrentDisjointSet ds(n);
+    std::atomic<std::size_t> merges(0);
+
+    WorkStealingPool pool(4);
+    pool.parallelFor(1, n, 1000, [&](std::size_t from, std::size_t to)
+    {
+        for(std::size_t i = from; i < to; ++i)
+        {
+            if(ds.unite(static_cast<ConcurrentDisjointSet::Elem>(i - 1),
+                        static_cast<ConcurrentDisjointSet::Elem>(i)))
+                ++merges;
+        }
+    });
+
+    EXPECT_EQ(n - 1, merges.load());
+    ConcurrentDisjointSet::Elem root = ds.find(0);
+    for(std::size_t i = 0; i < n; ++i)
+        EXPECT_EQ(root, ds.find(static_cast<ConcurrentDisjointSet::Elem>(i)));
+    EXPECT_FALSE(ds.unite(5, 77));
+}
@@ -16,9 +16,12 @@
 
 #include "ugraph/ugraph_algos.hpp"
 #include "grviz/ugraph_dotwriter.hpp"
+#include "test_graphs.hpp"
 
 // TODO: set the GV_OUT_DIR macros to the path in your local environment!
+#ifndef GV_OUT_DIR
 #define GV_OUT_DIR "f:/temp/2020/20200922/gv/"
+#endif
 
 
 TEST(UgraphAlgos, simplest)
@@ -49,6 +52,20 @@ CharIntGraph makeGraphFromEdges(const CharIntGraph& origG,
     return mst;
 }
 
+// Sums up labels of the given edges of the graph \a g.
+int getEdgesWeight(const CharIntGraph& g, const CharIntGraphEdgesSet& edges)
+{
+    int res = 0;
+    for(auto edge : edges)
+    {
+        int lbl;
+        if(g.getLabel(edge.first, edge.second, lbl))
+            res += lbl;
+    }
+
+    return res;
+}
+
 TEST(UgraphAlgos, mstPrim1)
 {
     // Creates a graph
@@ -79,10 +96,317 @@ TEST(UgraphAlgos, mstPrim1)
     CharIntGraph mst = makeGraphFromEdges(g, mstEdges);
     dw.write(GV_OUT_DIR "clrs_graph_mst.gv", mst, "MST for CLRS Graph (Prim)");
 
+    EXPECT_EQ(8, mstEdges.size());
+    EXPECT_EQ(37, getEdgesWeight(g, mstEdges));
+
+    // Prim on a snapshot
+    EXPECT_EQ(mstEdges, findMSTPrim(g.freeze()));
+}
+
+// Tests Prim's algorithm on a graph with self-loops, an unlabeled edge and two
+// components.
+TEST(UgraphAlgos, mstPrimForest)
+{
+    CharIntGraph g;
+    g.addLblEdge('a', 'b', 3);
+    g.addLblEdge('b', 'c', 1);
+    g.addLblEdge('a', 'c', 2);
+    g.addLblEdge('c', 'c', 0);
+    g.addEdge('a', 'd');
+    g.addLblEdge('x', 'y', 5);
+    g.addLblEdge('y', 'z', 4);
+    g.addLblEdge('z', 'x', 6);
+
+    CharIntGraphEdgesSet mstEdges = findMSTPrim(g);
+    CharIntGraphEdgesSet expected = {{'a', 'c'}, {'b', 'c'}, {'x', 'y'}, {'y', 'z'}};
+    EXPECT_EQ(expected, mstEdges);
+    EXPECT_EQ(expected, findMSTPrim(g.freeze()));
 }
 
 TEST(UgraphAlgos, mstKruskal1)
 {
-    // TODO:
+    // Creates a graph
+    CharIntGraph g;
+    g.addLblEdge('a', 'b', 4);
+    g.addLblEdge('b', 'c', 8);
+    g.addLblEdge('b', 'h', 11);
+    g.addLblEdge('c', 'd', 7);
+    g.addLblEdge('c', 'i', 2);
+    g.addLblEdge('c', 'f', 4);
+    g.addLblEdge('d', 'e', 9);
+    g.addLblEdge('d', 'f', 14);
+    g.addLblEdge('e', 'f', 10);
+    g.addLblEdge('f', 'g', 2);
+    g.addLblEdge('g', 'h', 1);
+    g.addLblEdge('g', 'i', 6);
+    g.addLblEdge('h', 'a', 8);
+    g.addLblEdge('h', 'i', 7);
+
+    // Kruskal
+    CharIntGraphEdgesSet mstEdges = findMSTKruskal(g);
+    CharIntGraph mst = makeGraphFromEdges(g, mstEdges);
+    CharIntGraphDW dw;   // dotwriter
+    dw.write(GV_OUT_DIR "clrs_graph_mst_kruskal.gv", mst, "MST for CLRS Graph (Kruskal)");
+
+    EXPECT_EQ(8, mstEdges.size());
+    EXPECT_EQ(37, getEdgesWeight(g, mstEdges));
+    EXPECT_EQ(mstEdges, findMSTKruskal(g.freeze()));
+}
+
+// Tests Kruskal's algorithm on the same graph as mstPrimForest.
+TEST(UgraphAlgos, mstKruskalForest)
+{
+    CharIntGraph g;
+    g.addLblEdge('a', 'b', 3);
+    g.addLblEdge('b', 'c', 1);
+    g.addLblEdge('a', 'c', 2);
+    g.addLblEdge('c', 'c', 0);
+    g.addEdge('a', 'd');
+    g.addLblEdge('x', 'y', 5);
+    g.addLblEdge('y', 'z', 4);
+    g.addLblEdge('z', 'x', 6);
+
+    CharIntGraphEdgesSet expected = {{'a', 'c'}, {'b', 'c'}, {'x', 'y'}, {'y', 'z'}};
+    EXPECT_EQ(expected, findMSTKruskal(g));
+    EXPECT_EQ(expected, findMSTKruskal(g.freeze()));
+}
+
+// Compares all the engines on pseudo-random graphs.
+TEST(UgraphAlgos, mstEnginesAgree)
+{
+    for(unsigned seed = 1; seed <= 5; ++seed)
+    {
+        IntIntGraph g = makeRandomGraph<IntIntGraph>(200, 600, seed);
+        IntIntGraph::Snapshot sn = g.freeze();
+
+        std::set<IntIntGraph::Edge> prim = findMSTPrim(g);
+        EXPECT_EQ(prim, findMSTPrim(sn));
+        EXPECT_EQ(prim, findMSTKruskal(g));
+        EXPECT_EQ(prim, findMSTKruskal(sn));
+        EXPECT_EQ(prim, findMSTParallel(g, 1));
+        EXPECT_EQ(prim, findMSTParallel(sn, 4));
+    }
+}
+
+// Tests Borůvka's algorithm on a larger graph with ties and several components
+// using one pool for several runs.
+TEST(UgraphAlgos, mstParallel)
+{
+    IntIntGraph g;
+    const int n = 3000;
+    for(int i = 0; i < n; ++i)
+    {
+        if(i % 1000 != 999)
+            g.addLblEdge(i, i + 1, i % 5);
+        g.addLblEdge(i, (i * 37 + 11) % n, i % 7);
+    }
+
+    WorkStealingPool pool(3);
+    std::set<IntIntGraph::Edge> kruskal = findMSTKruskal(g);
+    std::set<IntIntGraph::Edge> boruvka = findMSTParallel(g, pool);
+    EXPECT_EQ(kruskal.size(), boruvka.size());
+
+    int kw = 0, bw = 0, lbl;
+    for(const IntIntGraph::Edge& e : kruskal)
+        kw += g.getLabel(e.first, e.second, lbl) ? lbl : 0;
+    for(const IntIntGraph::Edge& e : boruvka)
+        bw += g.getLabel(e.first, e.second, lbl) ? lbl : 0;
+    EXPECT_EQ(kw, bw);
+
+    EXPECT_EQ(boruvka, findMSTParallel(g.freeze(), pool));
+    EXPECT_TRUE(findMSTParallel(IntIntGraph(), pool).empty());
+}
+
+
+// Tests engines on graphs w/ floating point and 64-bit weights that differ
+// only in fractional parts or in high bits.
+TEST(UgraphAlgos, mstNonIntWeights)
+{
+    typedef EdgeLblUGraph<int, double> IntDoubleGraph;
+    IntDoubleGraph gd;
+    gd.addLblEdge(1, 2, 0.5);
+    gd.addLblEdge(2, 3, 0.25);
+    gd.addLblEdge(1, 3, 0.75);
+    gd.addLblEdge(3, 4, std::numeric_limits<double>::quiet_NaN());
+    gd.addLblEdge(2, 4, 1e9);
+
+    std::set<IntDoubleGraph::Edge> expected = {{1, 2}, {2, 3}, {2, 4}};
+    EXPECT_EQ(expected, findMSTPrim(gd));
+    EXPECT_EQ(expected, findMSTPrim(gd.freeze()));
+    EXPECT_EQ(expected, findMSTKruskal(gd));
+    EXPECT_EQ(expected, findMSTParallel(gd, 2));
+
+    typedef EdgeLblUGraph<int, std::int64_t> IntInt64Graph;
+    IntInt64Graph gl;
+    const std::int64_t big = std::int64_t(1) << 40;
+    gl.addLblEdge(1, 2, big + 1);
+    gl.addLblEdge(2, 3, big);
+    gl.addLblEdge(1, 3, 2);
+
+    std::set<IntInt64Graph::Edge> expected64 = {{1, 3}, {2, 3}};
+    EXPECT_EQ(expected64, findMSTPrim(gl));
+    EXPECT_EQ(expected64, findMSTKruskal(gl.freeze()));
+    EXPECT_EQ(expected64, findMSTParallel(gl.freeze(), 2));
+}
+
+// Heaviest edges according to custom weight traits.
+struct ReversedWeightTraits {
+    typedef std::greater<int> Compare;
+    static int zero() { return 0; }
+    static int infinity() { return std::numeric_limits<int>::min(); }
+};
+
+// Tests passing custom weight traits to the engines.
+TEST(UgraphAlgos, mstCustomWeightTraits)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 1);
+    g.addLblEdge(2, 3, 2);
+    g.addLblEdge(1, 3, 3);
+
+    std::set<IntIntGraph::Edge> expected = {{1, 3}, {2, 3}};
+    EXPECT_EQ(expected, (findMSTPrim<int, int, ReversedWeightTraits>(g)));
+    EXPECT_EQ(expected, (findMSTKruskal<int, int, ReversedWeightTraits>(g.freeze())));
+    EXPECT_EQ(expected, (findMSTParallel<int, int, ReversedWeightTraits>(g, 2)));
+}
+
+// Tests the matrix variant of Prim's algorithm on random graphs, a complete
+// graph and graphs w/ several components, infinite and NaN weights.
+TEST(UgraphAlgos, mstPrimDense)
+{
+    for(unsigned seed = 1; seed <= 3; ++seed)
+    {
+        IntIntGraph g = makeRandomGraph<IntIntGraph>(100, 2000, seed);
+        std::set<IntIntGraph::Edge> heap = findMSTPrimHeap(g);
+        EXPECT_EQ(heap, findMSTPrimDense(g));
+        EXPECT_EQ(heap, findMSTPrimDense(g.freeze()));
+        EXPECT_EQ(heap, findMSTPrim(g));                // dense enough
+        EXPECT_TRUE(isDenseGraph(g.getVerticesNum(), g.getEdgesNum()));
+        EXPECT_FALSE(isDenseGraph(g.getVerticesNum(), g.getEdgesNum(), 0.5));
+    }
+
+    IntIntGraph complete;
+    for(int s = 0; s < 60; ++s)
+        for(int d = s + 1; d < 60; ++d)
+            complete.addLblEdge(s, d, (s * 31 + d * 17) % 1000 + s + d * 60);
+    EXPECT_TRUE(isDenseGraph(complete.getVerticesNum(), complete.getEdgesNum(), 1));
+    EXPECT_FALSE(isDenseGraph(complete.getVerticesNum(), complete.getEdgesNum(), 1.5));
+    EXPECT_EQ(findMSTKruskal(complete), findMSTPrimDense(complete.freeze()));
+
+    IntIntGraph forest;
+    forest.addLblEdge(1, 2, std::numeric_limits<int>::max());
+    forest.addLblEdge(2, 3, 1);
+    forest.addLblEdge(3, 3, 0);
+    forest.addEdge(3, 4);
+    forest.addLblEdge(5, 6, 2);
+    forest.addVertex(7);
+    std::set<IntIntGraph::Edge> expected = {{1, 2}, {2, 3}, {5, 6}};
+    EXPECT_EQ(expected, findMSTPrimDense(forest));
+    EXPECT_EQ(expected, findMSTPrimDense(forest.freeze()));
+
+    typedef EdgeLblUGraph<int, float> IntFloatGraph;
+    IntFloatGraph gf;
+    for(int i = 0; i < 40; ++i)
+        gf.addLblEdge(i, i + 1, i == 20 ? std::numeric_limits<float>::quiet_NaN() : 0.5f * i);
+    gf.addLblEdge(0, 40, 100.0f);
+    std::set<IntFloatGraph::Edge> expectedF = findMSTKruskal(gf);
+    EXPECT_EQ(40, expectedF.size());
+    EXPECT_EQ(0, expectedF.count({20, 21}));
+    EXPECT_EQ(expectedF, findMSTPrimDense(gf));
+
+    EXPECT_TRUE(findMSTPrimDense(IntIntGraph()).empty());
+}
+
+// Tests that a workspace reused by graphs of different sizes gives the same
+// MSTs and keeps its memory once it has seen the largest graph.
+TEST(UgraphAlgos, mstWorkspace)
+{
+    MSTWorkspace<int, int> ws;
+    std::vector<IntIntGraph::Edge> res;
+
+    IntIntGraph big = makeRandomGraph<IntIntGraph>(200, 1500, 5);
+    findMSTPrimHeap(big, ws, res);
+    EXPECT_EQ(findMSTKruskal(big), std::set<IntIntGraph::Edge>(res.begin(), res.end()));
+    EXPECT_TRUE(std::is_sorted(res.begin(), res.end()));
+
+    const IntIntGraph::Edge* data = res.data();
+    const int* indexData = ws.getIndex().getVertices().data();
+    const VertexId* parentsData = ws.getParents().data();
+    for(unsigned seed = 1; seed <= 5; ++seed)
+    {
+        IntIntGraph g = makeRandomGraph<IntIntGraph>(20 * seed, 100 * seed, seed);
+        std::set<IntIntGraph::Edge> expected = findMSTKruskal(g);
+
+        findMSTPrimHeap(g, ws, res);
+        EXPECT_EQ(expected, std::set<IntIntGraph::Edge>(res.begin(), res.end()));
+        findMSTPrimHeap(g.freeze(), ws, res);
+        EXPECT_EQ(expected, std::set<IntIntGraph::Edge>(res.begin(), res.end()));
+    }
+    EXPECT_EQ(data, res.data());
+    EXPECT_EQ(indexData, ws.getIndex().getVertices().data());
+    EXPECT_EQ(parentsData, ws.getParents().data());
+
+    findMSTPrimHeap(IntIntGraph(), ws, res);
+    EXPECT_TRUE(res.empty());
 }
 
+// Tests streaming MST edges w/ their labels to callbacks and output iterators.
+TEST(UgraphAlgos, mstEdgeSinks)
+{
+    CharIntGraph g;
+    g.addLblEdge('a', 'b', 3);
+    g.addLblEdge('b', 'c', 1);
+    g.addLblEdge('a', 'c', 2);
+    g.addLblEdge('c', 'c', 0);
+    g.addEdge('a', 'd');
+    g.addLblEdge('z', 'y', 5);
+    g.addLblEdge('y', 'x', 4);
+    g.addLblEdge('z', 'x', 6);
+
+    CharIntGraphEdgesSet expected = findMSTPrim(g);
+    for(const MSTEdges<char, int>& mst : {findMSTEdges(g), findMSTEdges(g.freeze())})
+    {
+        EXPECT_EQ(12, mst.weight);
+        ASSERT_EQ(4, mst.edges.size());
+
+        CharIntGraph mstG;
+        CharIntGraphEdgesSet edges;
+        for(const LblEdge<char, int>& e : mst.edges)
+        {
+            EXPECT_LT(e.s, e.d);
+            mstG.addLblEdge(e.s, e.d, e.lbl);
+            edges.insert(std::make_pair(e.s, e.d));
+        }
+        EXPECT_EQ(expected, edges);
+        EXPECT_EQ(12, getEdgesWeight(mstG, edges));
+
+        // edges of a tree are adjacent
+        EXPECT_EQ(mst.edges[0].s < 'x', mst.edges[1].s < 'x');
+        EXPECT_EQ(mst.edges[2].s < 'x', mst.edges[3].s < 'x');
+    }
+
+    std::vector<LblEdge<char, int> > out(5);
+    auto last = findMSTEdges(g, out.begin());
+    EXPECT_EQ(4, last - out.begin());
+    EXPECT_EQ('b', out[1].s);
+    EXPECT_EQ('c', out[1].d);
+    EXPECT_EQ(1, out[1].lbl);
+
+    IntIntGraph big = makeRandomGraph<IntIntGraph>(300, 2000, 9);
+    MSTWorkspace<int, int> ws;
+    std::size_t edgesNum = 0;
+    int weight = 0;
+    forEachMSTEdge(big.freeze(), ws, [&](int u, int v, int lbl)
+    {
+        int expectedLbl;
+        EXPECT_TRUE(big.getLabel(u, v, expectedLbl));
+        EXPECT_EQ(expectedLbl, lbl);
+        ++edgesNum;
+        weight += lbl;
+    });
+    EXPECT_EQ(findMSTKruskal(big).size(), edgesNum);
+    EXPECT_EQ(findMSTEdges(big).weight, weight);
+
+    EXPECT_TRUE(findMSTEdges(IntIntGraph()).edges.empty());
+    EXPECT_EQ(0, findMSTEdges(IntIntGraph()).weight);
+}
@@ -15,10 +15,16 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
 #include "ugraph/lbl_ugraph.hpp"
 #include "grviz/ugraph_dotwriter.hpp"
 
+#ifndef GV_OUT_DIR
 #define GV_OUT_DIR "f:/temp/2020/20200922/gv/"
+#endif
 
 TEST(UGraphDotWriter, simplest)
 {
@@ -26,6 +32,16 @@ TEST(UGraphDotWriter, simplest)
 
 typedef EdgeLblUGraph<int, int> IntIntGraph;
 typedef EdgeLblUGraphDotWriter<int, int>::Type IntIntGraphDW;
+typedef CsrSnapshotDotWriter<int, int>::Type IntIntSnapshotDW;
+
+// Reads the whole file \a fn into a string.
+std::string readFile(const std::string& fn)
+{
+    std::ifstream f(fn.c_str(), std::ios::binary);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
 
 TEST(UGraphDotWriter, simpleGraph)
 {
@@ -38,3 +54,111 @@ TEST(UGraphDotWriter, simpleGraph)
     IntIntGraphDW dw;   // dotwriter
     dw.write(GV_OUT_DIR "test1.gv", g, "Test Graph");
 }
+
+TEST(UGraphDotWriter, snapshot)
+{
+    IntIntGraph g;      // graph
+    g.addLblEdge(1, 2, 10);
+    g.addLblEdge(1, 3, 20);
+    g.addEdge(1, 4);
+    g.addLblEdge(2, 2, 30);
+    g.addLblEdge(2, 4, 40);
+
+    IntIntGraphDW dw;
+    dw.write(GV_OUT_DIR "test2.gv", g, "Test Graph");
+    IntIntSnapshotDW sdw;
+    sdw.write(GV_OUT_DIR "test2_snapshot.gv", g.freeze(), "Test Graph");
+
+    std::string expected = readFile(GV_OUT_DIR "test2.gv");
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, readFile(GV_OUT_DIR "test2_snapshot.gv"));
+}
+
+// Compares buffered and unbuffered output for various types of labels.
+TEST(UGraphDotWriter, bufferedSameAsUnbuffered)
+{
+    IntIntGraph g;
+    for(int i = 0; i < 5000; ++i)
+        g.addLblEdge(i, (i * 7 + 3) % 5000, i - 2500);
+    g.addEdge(1, 4999);
+    g.addLblEdge(7, 7, -1);
+
+    IntIntGraphDW(EdgeLblUGraphDotVisitor<int, int>(false))
+        .write(GV_OUT_DIR "test3_unbuffered.gv", g, "Test Graph");
+    IntIntGraphDW(EdgeLblUGraphDotVisitor<int, int>(true))
+        .write(GV_OUT_DIR "test3_buffered.gv", g, "Test Graph");
+    EXPECT_EQ(readFile(GV_OUT_DIR "test3_unbuffered.gv"),
+              readFile(GV_OUT_DIR "test3_buffered.gv"));
+
+    IntIntSnapshotDW(CsrSnapshotDotVisitor<int, int>(false))
+        .write(GV_OUT_DIR "test3_snapshot_unbuffered.gv", g.freeze());
+    IntIntSnapshotDW(CsrSnapshotDotVisitor<int, int>(true))
+        .write(GV_OUT_DIR "test3_snapshot_buffered.gv", g.freeze());
+    EXPECT_EQ(readFile(GV_OUT_DIR "test3_snapshot_unbuffered.gv"),
+              readFile(GV_OUT_DIR "test3_snapshot_buffered.gv"));
+
+    typedef EdgeLblUGraph<char, std::string> CharStrGraph;
+    typedef EdgeLblUGraphDotWriter<char, std::string>::Type CharStrGraphDW;
+    CharStrGraph g2;
+    g2.addLblEdge('a', 'b', "say \"hi\"");
+    g2.addLblEdge('b', 'c', "back\\slash");
+    g2.addEdge('c', 'a');
+
+    CharStrGraphDW(EdgeLblUGraphDotVisitor<char, std::string>(false))
+        .write(GV_OUT_DIR "test4_unbuffered.gv", g2);
+    CharStrGraphDW(EdgeLblUGraphDotVisitor<char, std::string>(true))
+        .write(GV_OUT_DIR "test4_buffered.gv", g2);
+    std::string expected = readFile(GV_OUT_DIR "test4_unbuffered.gv");
+    EXPECT_NE(std::string::npos, expected.find("a -- b [label=\"say \\\"hi\\\"\"]\n"));
+    EXPECT_EQ(expected, readFile(GV_OUT_DIR "test4_buffered.gv"));
+
+    typedef EdgeLblUGraph<long long, double> LongDblGraph;
+    typedef EdgeLblUGraphDotWriter<long long, double>::Type LongDblGraphDW;
+    LongDblGraph g3;
+    g3.addLblEdge(-9000000000LL, 5, 0.125);
+    g3.addLblEdge(5, 6, 1e20);
+
+    LongDblGraphDW(EdgeLblUGraphDotVisitor<long long, double>(false))
+        .write(GV_OUT_DIR "test5_unbuffered.gv", g3);
+    LongDblGraphDW(EdgeLblUGraphDotVisitor<long long, double>(true))
+        .write(GV_OUT_DIR "test5_buffered.gv", g3);
+    EXPECT_EQ(readFile(GV_OUT_DIR "test5_unbuffered.gv"),
+              readFile(GV_OUT_DIR "test5_buffered.gv"));
+}
+
+// Tests writing through a small buffer.
+TEST(UGraphDotWriter, outBuffer)
+{
+    std::ostringstream ss;
+    {
+        xi::ldopa::graph::DotOutBuffer out(ss, 64);
+        out << "vertex " << -123 << ' ' << 'x' << ' ' << 0u << "\n";
+        for(int i = 0; i < 100; ++i)
+            out << i;
+        out.putEscapedValue(std::string("a\"b"));
+        out.putEscapedValue(-5);
+        out.put(std::string(200, 'z').c_str(), 200);
+    }
+
+    std::string expected = "vertex -123 x 0\n";
+    for(int i = 0; i < 100; ++i)
+        expected += std::to_string(i);
+    expected += "\"a\\\"b\"\"-5\"" + std::string(200, 'z');
+    EXPECT_EQ(expected, ss.str());
+}
+
+// Tests that the buffer formats values with the flags of its stream.
+TEST(UGraphDotWriter, outBufferFormat)
+{
+    std::ostringstream expected;
+    expected << std::setprecision(3) << std::hex << std::showbase;
+    std::ostringstream ss;
+    ss.copyfmt(expected);
+    {
+        xi::ldopa::graph::DotOutBuffer out(ss, 64);
+        out << 255 << ' ' << 3.14159 << ' ' << -1L;
+    }
+    expected << 255 << ' ' << 3.14159 << ' ' << -1L;
+    EXPECT_EQ(expected.str(), ss.str());
+    EXPECT_EQ(0u, ss.str().find("0xff 3.14 "));
+}
@@ -157,3 +157,55 @@ TEST(UGraph, iterEdges2)
     EXPECT_EQ(6, c);
 }
 
+
+
+
+// Tests bulk addition of edges w/ a hub vertex, duplicates and self-loops.
+TEST(UGraph, addEdges)
+{
+    typedef UGraph<int> IntGraph;
+    IntGraph g1, g2;
+
+    std::vector<std::pair<int, int> > edges;
+    for (int i = 1; i <= 100; ++i)
+        edges.push_back(std::make_pair(i % 2 ? 0 : i, i % 2 ? i : 0));
+    edges.push_back(std::make_pair(7, 0));
+    edges.push_back(std::make_pair(3, 3));
+    edges.push_back(std::make_pair(3, 3));
+
+    g1.addEdge(0, 1);
+    g2.addEdge(0, 1);
+    for (const std::pair<int, int>& e : edges)
+        g1.addEdge(e.first, e.second);
+    g2.addEdges(edges.begin(), edges.end());
+
+    EXPECT_EQ(g1.getVerticesNum(), g2.getVerticesNum());
+    EXPECT_EQ(g1.getEdgesNum(), g2.getEdgesNum());
+    EXPECT_EQ(101, g2.getEdgesNum());
+    EXPECT_EQ(100, std::distance(g2.getAdjEdges(0).first, g2.getAdjEdges(0).second));
+
+    std::set<IntGraph::Edge> es1(g1.getEdges().first, g1.getEdges().second);
+    std::set<IntGraph::Edge> es2(g2.getEdges().first, g2.getEdges().second);
+    EXPECT_EQ(es1, es2);
+}
+
+// Tests removing edges including self-loops; vertices stay.
+TEST(UGraph, removeEdge)
+{
+    UGraph<int> g;
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+    g.addEdge(3, 3);
+
+    EXPECT_TRUE(g.removeEdge(2, 1));
+    EXPECT_FALSE(g.removeEdge(1, 2));
+    EXPECT_FALSE(g.isEdgeExists(1, 2));
+    EXPECT_FALSE(g.isEdgeExists(2, 1));
+    EXPECT_TRUE(g.isEdgeExists(2, 3));
+    EXPECT_EQ(3, g.getVerticesNum());
+
+    EXPECT_TRUE(g.removeEdge(3, 3));
+    EXPECT_FALSE(g.isEdgeExists(3, 3));
+    EXPECT_EQ(1, g.getEdgesNum());
+    EXPECT_FALSE(g.removeEdge(4, 5));
+}
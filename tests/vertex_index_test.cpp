@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for dense numbering of vertices.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "ugraph/vertex_index.hpp"
+
+
+TEST(VertexIndex, empty)
+{
+    VertexIndex<int> idx;
+    EXPECT_TRUE(idx.isEmpty());
+    EXPECT_EQ(VertexIndex<int>::NoId, idx.getId(1));
+}
+
+TEST(VertexIndex, fromGraph)
+{
+    UGraph<std::string> g;
+    g.addEdge("delta", "alpha");
+    g.addEdge("charlie", "alpha");
+    g.addVertex("bravo");
+
+    VertexIndex<std::string> idx(g);
+    EXPECT_EQ(4, idx.getSize());
+
+    // ids follow the order of vertices
+    EXPECT_EQ(0, idx.getId("alpha"));
+    EXPECT_EQ(1, idx.getId("bravo"));
+    EXPECT_EQ(2, idx.getId("charlie"));
+    EXPECT_EQ(3, idx.getId("delta"));
+    EXPECT_EQ(VertexIndex<std::string>::NoId, idx.getId("echo"));
+
+    for(VertexId id = 0; id < idx.getSize(); ++id)
+        EXPECT_EQ(id, idx.getId(idx.getVertex(id)));
+
+    VertexId id;
+    EXPECT_TRUE(idx.findId("charlie", id));
+    EXPECT_EQ(2, id);
+    EXPECT_FALSE(idx.findId("aaa", id));
+}
+
+TEST(VertexIndex, fromRange)
+{
+    int vs[] = {5, 3, 9, 3, 5, 1};
+    VertexIndex<int> idx(vs, vs + 6);
+    EXPECT_EQ(4, idx.getSize());
+    EXPECT_EQ(0, idx.getId(1));
+    EXPECT_EQ(3, idx.getId(9));
+
+    std::vector<int> released = idx.release();
+    std::vector<int> expected = {1, 3, 5, 9};
+    EXPECT_EQ(expected, released);
+    EXPECT_TRUE(idx.isEmpty());
+}
+
+
+// Tests ids of integer vertices both found in the table and, when the span
+// of vertices is too wide for it, by the binary search.
+TEST(VertexIndex, intTable)
+{
+    int dense[] = {-3, 4, 0, -1, 7, 2};
+    VertexIndex<int> idx(dense, dense + 6);
+    EXPECT_EQ(0, idx.getId(-3));
+    EXPECT_EQ(1, idx.getId(-1));
+    EXPECT_EQ(5, idx.getId(7));
+    EXPECT_EQ(VertexIndex<int>::NoId, idx.getId(-2));
+    EXPECT_EQ(VertexIndex<int>::NoId, idx.getId(-4));
+    EXPECT_EQ(VertexIndex<int>::NoId, idx.getId(8));
+
+    long long sparse[] = {-1000000000000LL, 0, 1000000000000LL};
+    VertexIndex<long long> sidx(sparse, sparse + 3);
+    EXPECT_EQ(0, sidx.getId(-1000000000000LL));
+    EXPECT_EQ(2, sidx.getId(1000000000000LL));
+    EXPECT_EQ(VertexIndex<long long>::NoId, sidx.getId(1));
+
+    unsigned extremes[] = {0u, 4294967295u};
+    VertexIndex<unsigned> eidx(extremes, extremes + 2);
+    EXPECT_EQ(1, eidx.getId(4294967295u));
+    EXPECT_EQ(VertexIndex<unsigned>::NoId, eidx.getId(5u));
+}
@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Testing module for the weight traits.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       17.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <cstdint>
+
+#include "ugraph/weight_traits.hpp"
+
+
+TEST(WeightTraits, integers)
+{
+    typedef WeightTraits<std::int64_t> Traits;
+    Traits::Compare less;
+
+    EXPECT_EQ(0, Traits::zero());
+    EXPECT_EQ(std::numeric_limits<std::int64_t>::max(), Traits::infinity());
+    EXPECT_TRUE(less(-1, 0));
+    EXPECT_FALSE(less(Traits::infinity(), Traits::infinity()));
+
+    EXPECT_EQ(255, WeightTraits<unsigned char>::infinity());
+}
+
+
+TEST(WeightTraits, floatingPoint)
+{
+    typedef WeightTraits<float> Traits;
+    Traits::Compare less;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+
+    EXPECT_EQ(0.0f, Traits::zero());
+    EXPECT_EQ(std::numeric_limits<float>::infinity(), Traits::infinity());
+    EXPECT_TRUE(less(0.25f, 0.5f));
+    EXPECT_FALSE(less(0.5f, 0.25f));
+
+    // NaN is the heaviest weight and is equivalent to itself
+    EXPECT_TRUE(less(Traits::infinity(), nan));
+    EXPECT_FALSE(less(nan, Traits::infinity()));
+    EXPECT_FALSE(less(nan, nan));
+}
+
+
+TEST(WeightTraits, general)
+{
+    typedef WeightTraits<std::string> Traits;
+    Traits::Compare less;
+
+    EXPECT_EQ("", Traits::zero());
+    EXPECT_TRUE(less("a", "b"));
+}